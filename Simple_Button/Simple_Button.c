@@ -37,6 +37,79 @@
 /* FLAG : The button is initialized */
 #define SIMPLEBTN_IS_INIT_ 0x55
 
+#if SIMPLEBTN_MODE_ENABLE_REGISTRY != 0
+
+ #include <stddef.h>
+
+/* The head of the registry list (every initialized button) */
+static simpleButton_Type_RegistryNode_t* simpleButton_Private_RegistryHead = 0;
+
+/* The buttons `SimpleButton_Registry_HandleBudget()` resumes from (0 : the head) */
+static simpleButton_Type_RegistryNode_t* simpleButton_Private_RegistryBusyCursor = 0; /* buttons with a deadline */
+static simpleButton_Type_RegistryNode_t* simpleButton_Private_RegistryPollCursor = 0; /* idle buttons */
+
+/* Statistics of `SimpleButton_Registry_HandleBudget()` */
+static SimpleButton_Type_BudgetStats_t simpleButton_Private_BudgetStats;
+static uint32_t simpleButton_Private_BudgetLapBegin = 0; /* in us */
+
+/* Get the button object from its registry node */
+ #define SIMPLEBTN_REGISTRY_OWNER_(node, type) \
+    ((type*)(void*)((char*)(node) - offsetof(type, Registry)))
+
+/**
+ * @brief           Link the button into the registry. (called in critical section)
+ * 
+ * @note            Initializing a button twice will not link it twice, and
+ *                  will not clear the callback functions set for it.
+ */
+static void
+simpleButton_Private_Registry_Add(
+    simpleButton_Type_RegistryNode_t* const node,
+    const uint8_t is_dynamic
+) {
+    simpleButton_Type_RegistryNode_t** link = &simpleButton_Private_RegistryHead;
+
+    while (*link != 0) {
+        if (*link == node) {
+            return; /* already registered, keep its callback functions */
+        }
+        link = &((*link)->next);
+    }
+
+    node->callBacks.shortPushCallBack = 0;
+    node->callBacks.longPushCallBack = 0;
+    node->callBacks.repeatPushCallBack = 0;
+    node->is_dynamic = is_dynamic;
+
+    /* append, so the buttons are handled in the order of initialization */
+    node->next = 0;
+    *link = node;
+}
+
+#endif /* SIMPLEBTN_MODE_ENABLE_REGISTRY != 0 */
+
+#if SIMPLEBTN_MODE_ENABLE_TIMER_DRIVEN != 0
+
+/* The timer of timer-driven mode : 0 stopped, 1 every period, 2 reloaded to the next slow poll */
+static volatile uint8_t simpleButton_Private_TimerRunning = 0;
+
+#endif /* SIMPLEBTN_MODE_ENABLE_TIMER_DRIVEN != 0 */
+
+/* a helper function : start the periodic timer if it is stopped (timer-driven mode) */
+SIMPLEBTN_FORCE_INLINE void
+simpleButton_Private_TimerWake(void)
+{
+#if SIMPLEBTN_MODE_ENABLE_TIMER_DRIVEN != 0
+    if (simpleButton_Private_TimerRunning == 0) {
+        simpleButton_Private_TimerRunning = 1;
+        SIMPLEBTN_FUNC_TIMER_START();
+    } else if (simpleButton_Private_TimerRunning == 2) {
+        simpleButton_Private_TimerRunning = 1; /* back to the full rate at once */
+        SIMPLEBTN_FUNC_TIMER_RELOAD(SIMPLEBTN_TIME_TIMER_PERIOD);
+    }
+#endif /* SIMPLEBTN_MODE_ENABLE_TIMER_DRIVEN != 0 */
+}
+
 SIMPLEBTN_C_API void simpleButton_Private_InitStructPublic(
     simpleButton_Type_PublicBtnStatus_t* self_public
 ) {
@@ -46,6 +119,7 @@ SIMPLEBTN_C_API void simpleButton_Private_InitStructPublic(
     self_public->coolDownTime = SIMPLEBTN_TIME_COOL_DOWN;
     self_public->longPushMinTime = SIMPLEBTN_TIME_LONG_PUSH_MIN;
     self_public->repeatWindowTime = SIMPLEBTN_TIME_REPEAT_WINDOW;
+    self_public->repeatMaxCount = SIMPLEBTN_REPEAT_MAX_COUNT;
  #if SIMPLEBTN_MODE_ENABLE_LONGPUSH_HOLD != 0
     self_public->holdPushMinTime = SIMPLEBTN_TIME_HOLD_PUSH_MIN;
  #endif /* SIMPLEBTN_MODE_ENABLE_LONGPUSH_HOLD != 0 */
@@ -57,6 +131,11 @@ SIMPLEBTN_C_API void simpleButton_Private_InitStructPublic(
     self_public->combinationConfig.callBack = 0;
 #endif /* SIMPLEBTN_MODE_ENABLE_COMBINATION != 0 */
 
+#if SIMPLEBTN_MODE_ENABLE_PRESS_RELEASE_EVENT != 0
+    self_public->eventConfig.pressedCallBack = 0;
+    self_public->eventConfig.releasedCallBack = 0;
+#endif /* SIMPLEBTN_MODE_ENABLE_PRESS_RELEASE_EVENT != 0 */
+
 }
 
 SIMPLEBTN_C_API void simpleButton_Private_InitStructPrivate(
@@ -68,6 +147,23 @@ SIMPLEBTN_C_API void simpleButton_Private_InitStructPrivate(
     self_private->timeStamp_interrupt = 0;
     self_private->timeStamp_loop = 0;
 
+#if SIMPLEBTN_MODE_ENABLE_ADAPTIVE_DEBOUNCE != 0
+    /* start from the fixed delay, and learn the real bounce time later */
+    self_private->timeStamp_bounce = 0;
+    self_private->bounce_level = 0;
+    self_private->settle_push = (uint8_t)SIMPLEBTN_TIME_PUSH_DELAY;
+    self_private->settle_release = (uint8_t)SIMPLEBTN_TIME_RELEASE_DELAY;
+#endif /* SIMPLEBTN_MODE_ENABLE_ADAPTIVE_DEBOUNCE != 0 */
+
+#if SIMPLEBTN_MODE_ENABLE_SNAPSHOT != 0
+    self_private->snapshot.sequence = 0;
+    self_private->snapshot.slot[0].pushTick = 0;
+    self_private->snapshot.slot[0].eventTick = 0;
+    self_private->snapshot.slot[0].is_held = 0;
+    self_private->snapshot.slot[0].clickCount = 0;
+    self_private->snapshot.slot[0].lastEvent = SimpleButton_Event_None;
+#endif /* SIMPLEBTN_MODE_ENABLE_SNAPSHOT != 0 */
+
     /* flag : is initialized */
     self_private->is_init = SIMPLEBTN_IS_INIT_;
 }
@@ -106,9 +202,207 @@ SIMPLEBTN_C_API void simpleButton_Private_InitStruct(
 
     simpleButton_Private_InitStructPublic(&(self->Public));
 
+#if SIMPLEBTN_MODE_ENABLE_REGISTRY != 0
+    simpleButton_Private_Registry_Add(&(self->Registry), 0);
+#endif /* SIMPLEBTN_MODE_ENABLE_REGISTRY != 0 */
+
     SIMPLEBTN_FUNC_CRITICAL_SECTION_END();
 }
 
+/* a helper function : (re)start watching the bounce of the contact */
+SIMPLEBTN_FORCE_INLINE void
+simpleButton_Private_AdaptiveRestart(
+    simpleButton_Type_PrivateBtnStatus_t* const self_private,
+    const uint32_t timeStamp,
+    const uint8_t is_pushed
+) {
+#if SIMPLEBTN_MODE_ENABLE_ADAPTIVE_DEBOUNCE != 0
+    self_private->timeStamp_bounce = timeStamp;
+    self_private->bounce_level = is_pushed;
+#else
+    (void)self_private;
+    (void)timeStamp;
+    (void)is_pushed;
+#endif /* SIMPLEBTN_MODE_ENABLE_ADAPTIVE_DEBOUNCE != 0 */
+}
+
+#if SIMPLEBTN_MODE_ENABLE_ADAPTIVE_DEBOUNCE != 0
+
+/**
+ * @brief           Track the level of a bouncing contact.
+ * 
+ * @return          Non-zero when the level has been quiet for the learned
+ *                  bounce time plus the margin, or the fixed delay is over.
+ */
+SIMPLEBTN_FORCE_INLINE uint32_t
+simpleButton_Private_AdaptiveIsSettled(
+    simpleButton_Type_PrivateBtnStatus_t* const self_private,
+    const uint32_t timeStamp_start,
+    const uint32_t delay_max,
+    const uint8_t settle,
+    const uint8_t is_pushed
+) {
+    const uint32_t now = SIMPLEBTN_FUNC_GET_TICK();
+
+    if (is_pushed != self_private->bounce_level) {
+        self_private->bounce_level = is_pushed;
+        self_private->timeStamp_bounce = now;
+    }
+
+    if (now - timeStamp_start > delay_max) {
+        return 1; /* never wait longer than the fixed delay */
+    }
+
+    return (now - self_private->timeStamp_bounce > (uint32_t)settle + SIMPLEBTN_TIME_DEBOUNCE_MARGIN);
+}
+
+/**
+ * @brief           Update the learned bounce time with the observed one.
+ * 
+ * @note            A worse contact is followed at once, a better one slowly,
+ *                  so a single clean press cannot shrink the window too much.
+ */
+SIMPLEBTN_FORCE_INLINE void
+simpleButton_Private_AdaptiveLearn(
+    uint8_t* const settle,
+    const uint32_t observed,
+    const uint32_t delay_max
+) {
+    uint32_t estimate = *settle;
+
+    if (observed >= estimate) {
+        estimate = observed;
+    } else {
+        estimate -= (estimate - observed + 3U) >> 2;
+    }
+
+    if (estimate > delay_max) {
+        estimate = delay_max;
+    }
+    if (estimate < SIMPLEBTN_TIME_DEBOUNCE_MIN) {
+        estimate = SIMPLEBTN_TIME_DEBOUNCE_MIN;
+    }
+
+    *settle = (uint8_t)estimate;
+}
+
+#endif /* SIMPLEBTN_MODE_ENABLE_ADAPTIVE_DEBOUNCE != 0 */
+
+/* a helper function : compare-and-swap a word, non-zero if it was swapped */
+#if SIMPLEBTN_MODE_ENABLE_LOCKFREE_HANDOFF != 0 || SIMPLEBTN_MODE_ENABLE_DEFERRED_CALLBACK != 0
+SIMPLEBTN_FORCE_INLINE uint8_t
+simpleButton_Private_CompareAndSwap(
+    volatile uint32_t* const target,
+    uint32_t expected,
+    const uint32_t desired
+) {
+ #if defined(SIMPLEBTN_FUNC_COMPARE_AND_SWAP)
+    return (uint8_t)(SIMPLEBTN_FUNC_COMPARE_AND_SWAP(target, expected, desired) != 0);
+ #else
+    /* LDREX/STREX on Cortex-M3/M4/M7, LR/SC or AMOCAS on RISC-V with the A extension */
+    return (uint8_t)__atomic_compare_exchange_n(target, &expected, desired,
+        0, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE);
+ #endif /* defined(SIMPLEBTN_FUNC_COMPARE_AND_SWAP) */
+}
+#endif /* SIMPLEBTN_MODE_ENABLE_LOCKFREE_HANDOFF != 0 || SIMPLEBTN_MODE_ENABLE_DEFERRED_CALLBACK != 0 */
+
+/* a helper function : compare-and-swap the state, non-zero if it was swapped */
+#if SIMPLEBTN_MODE_ENABLE_LOCKFREE_HANDOFF != 0
+SIMPLEBTN_FORCE_INLINE uint8_t
+simpleButton_Private_SwapState(
+    simpleButton_Type_PrivateBtnStatus_t* const self_private,
+    const uint32_t expected,
+    const uint32_t desired
+) {
+    return simpleButton_Private_CompareAndSwap(&(self_private->state), expected, desired);
+}
+#endif /* SIMPLEBTN_MODE_ENABLE_LOCKFREE_HANDOFF != 0 */
+
+/* a helper function : a push takes an idle (or waiting-for-repeat) button to `Push_Delay` */
+SIMPLEBTN_FORCE_INLINE void
+simpleButton_Private_TakeOver(
+    simpleButton_Type_PrivateBtnStatus_t* const self_private,
+    const simpleButton_Type_ButtonState_t state,
+    const uint32_t now
+) {
+#if SIMPLEBTN_MODE_ENABLE_LOCKFREE_HANDOFF != 0
+    /* the CAS is the commit point, it fails only if the loop has just closed
+       the repeat window (the push is then too late) and nothing is touched */
+    if (!simpleButton_Private_SwapState(self_private, (uint32_t)state, simpleButton_State_Push_Claimed)) {
+        return;
+    }
+
+    self_private->timeStamp_interrupt = now;
+    simpleButton_Private_AdaptiveRestart(self_private, now, 1);
+
+    SIMPLEBTN_FUNC_MEMORY_BARRIER(); /* the push is stamped before the loop can see it */
+    self_private->state = simpleButton_State_Push_Delay;
+#else
+    (void)state;
+    self_private->timeStamp_interrupt = now;
+    simpleButton_Private_AdaptiveRestart(self_private, now, 1);
+    self_private->state = simpleButton_State_Push_Delay;
+#endif /* SIMPLEBTN_MODE_ENABLE_LOCKFREE_HANDOFF != 0 */
+}
+
+/* a helper function : the loop leaves `Wait_For_Repeat`, which the ISR may also leave */
+SIMPLEBTN_FORCE_INLINE void
+simpleButton_Private_LeaveWaiting(
+    simpleButton_Type_PrivateBtnStatus_t* const self_private,
+    const simpleButton_Type_ButtonState_t desired
+) {
+#if SIMPLEBTN_MODE_ENABLE_LOCKFREE_HANDOFF != 0
+    const simpleButton_Type_ButtonState_t state = (simpleButton_Type_ButtonState_t)(self_private->state);
+
+    if (state == simpleButton_State_Wait_For_Repeat || state == simpleButton_State_Push_Claimed) {
+        /* if the ISR wins (or has claimed it), the new push goes on and this decision is dropped */
+        (void)simpleButton_Private_SwapState(self_private, simpleButton_State_Wait_For_Repeat, desired);
+        return;
+    }
+#endif /* SIMPLEBTN_MODE_ENABLE_LOCKFREE_HANDOFF != 0 */
+
+    self_private->state = desired;
+}
+
+/**
+ * @brief           Publish the snapshot of a button after one of its events.
+ * 
+ * @param[inout]    self_private - pointer to self.Private struct.
+ * @param[in]       is_held - Non-zero if the button is pushed (debounced).
+ * @param[in]       event - The event. (SimpleButton_Type_BtnEvent_t)
+ * 
+ * @return          None
+ * 
+ * @note            Only the while loop writes the snapshot. The new one is written
+ *                  into the slot the readers are not using, then the sequence
+ *                  is moved on, so a reader (even an ISR which interrupts this
+ *                  function) always finds a complete slot.
+ */
+SIMPLEBTN_FORCE_INLINE void
+simpleButton_Private_Publish(
+    simpleButton_Type_PrivateBtnStatus_t* const self_private,
+    const uint8_t is_held,
+    const SimpleButton_Type_BtnEvent_t event
+) {
+#if SIMPLEBTN_MODE_ENABLE_SNAPSHOT != 0
+    const uint32_t sequence = self_private->snapshot.sequence + 1U;
+    volatile SimpleButton_Type_BtnSnapshot_t* const slot = &(self_private->snapshot.slot[sequence & 1U]);
+
+    slot->pushTick = self_private->timeStamp_interrupt;
+    slot->eventTick = SIMPLEBTN_FUNC_GET_TICK();
+    slot->is_held = is_held;
+    slot->clickCount = self_private->push_time;
+    slot->lastEvent = (uint8_t)event;
+
+    SIMPLEBTN_FUNC_MEMORY_BARRIER(); /* the slot is complete before it is published */
+    self_private->snapshot.sequence = sequence;
+#else
+    (void)self_private;
+    (void)is_held;
+    (void)event;
+#endif /* SIMPLEBTN_MODE_ENABLE_SNAPSHOT != 0 */
+}
+
 /**
  * @brief           Change the status of each button when during the EXTI interrupt
  *                  service routine.
@@ -118,13 +412,175 @@ SIMPLEBTN_C_API void simpleButton_Private_InitStruct(
 SIMPLEBTN_C_API void simpleButton_Private_InterruptHandler(
     simpleButton_Type_PrivateBtnStatus_t* self_private
 ) {
-    if (
-        (simpleButton_Type_ButtonState_t)(self_private->state) == simpleButton_State_Wait_For_Interrupt
-        || (simpleButton_Type_ButtonState_t)(self_private->state) == simpleButton_State_Wait_For_Repeat
-    ) {
-        self_private->timeStamp_interrupt = SIMPLEBTN_FUNC_GET_TICK_FromISR();
-        self_private->state = simpleButton_State_Push_Delay;
+    const simpleButton_Type_ButtonState_t state = (simpleButton_Type_ButtonState_t)(self_private->state);
+
+    if (state == simpleButton_State_Wait_For_Interrupt || state == simpleButton_State_Wait_For_Repeat) {
+        simpleButton_Private_TakeOver(self_private, state, SIMPLEBTN_FUNC_GET_TICK_FromISR());
+        simpleButton_Private_TimerWake();
+    }
+#if SIMPLEBTN_MODE_ENABLE_ADAPTIVE_DEBOUNCE != 0
+    else if (state == simpleButton_State_Push_Delay || state == simpleButton_State_Release_Delay) {
+        /* edge activity while debouncing, the contact is not quiet yet */
+        self_private->timeStamp_bounce = SIMPLEBTN_FUNC_GET_TICK_FromISR();
+    }
+#endif /* SIMPLEBTN_MODE_ENABLE_ADAPTIVE_DEBOUNCE != 0 */
+}
+
+#if SIMPLEBTN_MODE_ENABLE_DEFERRED_CALLBACK != 0
+
+/* The kind of a deferred callback (how to call it) */
+typedef enum simpleButton_Type_DeferredKind_t {
+    simpleButton_Deferred_NoArg = 0,
+
+    simpleButton_Deferred_TimeArg, /* long-push callback of timer-long-push mode */
+
+    simpleButton_Deferred_CountArg, /* repeat-push callback of counter-repeat-push mode */
+
+} simpleButton_Type_DeferredKind_t;
+
+/* One slot of the deferred callback queue */
+typedef struct simpleButton_Type_DeferredCall_t {
+
+    volatile uint32_t               sequence; /* lap + 1 when full, lap when free */
+
+    union {
+        void (* noArg)(void);
+        void (* timeArg)(uint32_t);
+        void (* countArg)(uint8_t);
+    } func;
+
+    uint32_t                        arg;
+
+    uint16_t                        key;
+
+    uint8_t                         kind;
+
+} simpleButton_Type_DeferredCall_t;
+
+/* The queue : bounded, many producers (the handlers), one consumer (the drain) */
+static simpleButton_Type_DeferredCall_t simpleButton_Private_DeferredQueue[SIMPLEBTN_DEFERRED_QUEUE_SIZE];
+static volatile uint32_t simpleButton_Private_DeferredHead = 0;
+static uint32_t simpleButton_Private_DeferredTail = 0;
+static volatile uint32_t simpleButton_Private_DeferredDrops = 0;
+
+/* The key of the deferred callback being called, only written by the drain */
+static volatile uint16_t simpleButton_Private_DeferredCurrentKey = 0;
+
+#define SIMPLEBTN_DEFERRED_MASK_            ((uint32_t)SIMPLEBTN_DEFERRED_QUEUE_SIZE - 1U)
+
+/**
+ * @brief           Put a callback into the deferred callback queue.
+ * 
+ * @param[in]       kind - How to call it. (simpleButton_Type_DeferredKind_t)
+ * @param[in]       func - The callback function. (not 0)
+ * @param[in]       arg - The argument of `TimeArg` / `CountArg` callbacks.
+ * @param[in]       keyOwner - The `currentKey` of the scan engine which the
+ *                  button is a key of, or 0. Its value is kept in the slot.
+ * 
+ * @return          None
+ * 
+ * @note            Lock-free : a slot is reserved by CAS on the head, then filled
+ *                  and marked full, so handlers on several threads (or an ISR)
+ *                  can defer at the same time. If the queue is full the call is
+ *                  dropped and counted.
+ */
+static void
+simpleButton_Private_Defer(
+    const simpleButton_Type_DeferredKind_t kind,
+    void (* const func)(void),
+    const uint32_t arg,
+    volatile uint16_t* const keyOwner
+) {
+    simpleButton_Type_DeferredCall_t* call;
+    uint32_t position = simpleButton_Private_DeferredHead;
+
+    for (;;) {
+        const uint32_t lap = position & ~SIMPLEBTN_DEFERRED_MASK_;
+        int32_t distance;
+
+        call = &(simpleButton_Private_DeferredQueue[position & SIMPLEBTN_DEFERRED_MASK_]);
+        SIMPLEBTN_FUNC_MEMORY_BARRIER(); /* the slot is checked after the head */
+        distance = (int32_t)(call->sequence - lap);
+
+        if (distance == 0) {
+            if (simpleButton_Private_CompareAndSwap(&simpleButton_Private_DeferredHead, position, position + 1U)) {
+                break; /* the slot is ours */
+            }
+        } else if (distance < 0) {
+            simpleButton_Private_DeferredDrops ++; /* full, the drain is too slow */
+            return;
+        }
+
+        position = simpleButton_Private_DeferredHead;
+    }
+
+    call->kind = (uint8_t)kind;
+    call->func.noArg = func;
+    call->arg = arg;
+    call->key = (keyOwner != 0) ? *keyOwner : 0U; /* the key being handled now */
+
+    SIMPLEBTN_FUNC_MEMORY_BARRIER(); /* the slot is complete before it is marked full */
+    call->sequence = (position & ~SIMPLEBTN_DEFERRED_MASK_) + 1U;
+
+    SIMPLEBTN_FUNC_DEFERRED_PEND(); /* wake the context which drains the queue */
+}
+
+#endif /* SIMPLEBTN_MODE_ENABLE_DEFERRED_CALLBACK != 0 */
+
+/* a helper function : deliver the pressed event */
+SIMPLEBTN_FORCE_INLINE void
+simpleButton_Private_Do_Pressed(
+    simpleButton_Type_PublicBtnStatus_t* const self_public,
+    volatile uint16_t* const keyOwner
+) {
+#if SIMPLEBTN_MODE_ENABLE_PRESS_RELEASE_EVENT != 0
+    simpleButton_Type_PressedCallBack_t pressedCallBack;
+    pressedCallBack = self_public->eventConfig.pressedCallBack;
+
+ #if SIMPLEBTN_MODE_ENABLE_DEFERRED_CALLBACK != 0
+    if (pressedCallBack != 0) {
+        simpleButton_Private_Defer(simpleButton_Deferred_NoArg, pressedCallBack, 0, keyOwner);
+    }
+ #else
+    (void)keyOwner;
+    if (pressedCallBack != 0) {
+        SIMPLEBTN_FUNC_CRITICAL_SECTION_END_M(); /* end multi-thread critical section */
+        pressedCallBack();
+        SIMPLEBTN_FUNC_CRITICAL_SECTION_BEGIN_M(); /* begin multi-thread critical section */
+    }
+ #endif /* SIMPLEBTN_MODE_ENABLE_DEFERRED_CALLBACK != 0 */
+#else
+    (void)self_public;
+    (void)keyOwner;
+#endif /* SIMPLEBTN_MODE_ENABLE_PRESS_RELEASE_EVENT != 0 */
+}
+
+/* a helper function : deliver the released event */
+SIMPLEBTN_FORCE_INLINE void
+simpleButton_Private_Do_Released(
+    simpleButton_Type_PublicBtnStatus_t* const self_public,
+    volatile uint16_t* const keyOwner
+) {
+#if SIMPLEBTN_MODE_ENABLE_PRESS_RELEASE_EVENT != 0
+    simpleButton_Type_ReleasedCallBack_t releasedCallBack;
+    releasedCallBack = self_public->eventConfig.releasedCallBack;
+
+ #if SIMPLEBTN_MODE_ENABLE_DEFERRED_CALLBACK != 0
+    if (releasedCallBack != 0) {
+        simpleButton_Private_Defer(simpleButton_Deferred_NoArg, releasedCallBack, 0, keyOwner);
+    }
+ #else
+    (void)keyOwner;
+    if (releasedCallBack != 0) {
+        SIMPLEBTN_FUNC_CRITICAL_SECTION_END_M(); /* end multi-thread critical section */
+        releasedCallBack();
+        SIMPLEBTN_FUNC_CRITICAL_SECTION_BEGIN_M(); /* begin multi-thread critical section */
     }
+ #endif /* SIMPLEBTN_MODE_ENABLE_DEFERRED_CALLBACK != 0 */
+#else
+    (void)self_public;
+    (void)keyOwner;
+#endif /* SIMPLEBTN_MODE_ENABLE_PRESS_RELEASE_EVENT != 0 */
 }
 
 SIMPLEBTN_FORCE_INLINE void
@@ -135,16 +591,30 @@ simpleButton_Private_StateWaitForInterrupt_Handler(void) {
 SIMPLEBTN_FORCE_INLINE void
 simpleButton_Private_StatePushDelay_Handler(
     simpleButton_Type_PrivateBtnStatus_t* const self_private,
-    const simpleButton_Type_GPIOBase_t gpiox_base,
-    const simpleButton_Type_GPIOPin_t  gpio_pin_x,
-    const simpleButton_Type_GPIOPinVal_t normal_pin_val
+    simpleButton_Type_PublicBtnStatus_t* const self_public,
+    const uint8_t is_pushed,
+    volatile uint16_t* const keyOwner
 ) {
+#if SIMPLEBTN_MODE_ENABLE_ADAPTIVE_DEBOUNCE != 0
+    if (!simpleButton_Private_AdaptiveIsSettled(self_private, self_private->timeStamp_interrupt,
+            SIMPLEBTN_TIME_PUSH_DELAY, self_private->settle_push, is_pushed)) {
+        return; /* still bouncing */
+    }
+
+    if (is_pushed) {
+        simpleButton_Private_AdaptiveLearn(&(self_private->settle_push),
+            self_private->timeStamp_bounce - self_private->timeStamp_interrupt, SIMPLEBTN_TIME_PUSH_DELAY);
+    }
+#else
     if (SIMPLEBTN_FUNC_GET_TICK() - self_private->timeStamp_interrupt <= SIMPLEBTN_TIME_PUSH_DELAY) {
         return; /* still need wait */
     }
+#endif /* SIMPLEBTN_MODE_ENABLE_ADAPTIVE_DEBOUNCE != 0 */
 
-    if (SIMPLEBTN_FUNC_READ_PIN(gpiox_base, gpio_pin_x) != normal_pin_val) {
+    if (is_pushed) {
         self_private->state = simpleButton_State_Wait_For_End;
+        simpleButton_Private_Publish(self_private, 1, SimpleButton_Event_Pressed);
+        simpleButton_Private_Do_Pressed(self_public, keyOwner);
     } else {
         if (self_private->push_time == 0) {
             self_private->state = simpleButton_State_Wait_For_Interrupt;
@@ -158,13 +628,13 @@ SIMPLEBTN_FORCE_INLINE void
 simpleButton_Private_StateWaitForEnd_Handler(
     simpleButton_Type_PrivateBtnStatus_t* const self_private,
     simpleButton_Type_PublicBtnStatus_t* const self_public,
-    const simpleButton_Type_GPIOBase_t gpiox_base,
-    const simpleButton_Type_GPIOPin_t  gpio_pin_x,
-    const simpleButton_Type_GPIOPinVal_t normal_pin_val,
-    simpleButton_Type_LongPushCallBack_t longPushCallback
+    const uint8_t is_pushed,
+    simpleButton_Type_LongPushCallBack_t longPushCallback,
+    volatile uint16_t* const keyOwner
 ) {
-    if (SIMPLEBTN_FUNC_READ_PIN(gpiox_base, gpio_pin_x) == normal_pin_val) {
+    if (!is_pushed) {
         self_private->timeStamp_loop = SIMPLEBTN_FUNC_GET_TICK();
+        simpleButton_Private_AdaptiveRestart(self_private, self_private->timeStamp_loop, 0);
         self_private->state = simpleButton_State_Release_Delay;
     } 
 #if SIMPLEBTN_MODE_ENABLE_LONGPUSH_HOLD != 0
@@ -183,10 +653,13 @@ simpleButton_Private_StateWaitForEnd_Handler(
     else if (SIMPLEBTN_FUNC_GET_TICK() - self_private->timeStamp_interrupt > SIMPLEBTN_TIME__TIMEOUT_NORMAL) {
 
 #if defined(SIMPLEBTN_DEBUG)
+        (void)keyOwner;
         SIMPLEBTN_FUNC_PANIC("normal long push time out", simpleButton_ErrorNum_NormalPushTimeOut, );
 #else
         self_private->push_time = 0;
         self_private->state = simpleButton_State_Wait_For_Interrupt;
+        simpleButton_Private_Publish(self_private, 0, SimpleButton_Event_Released);
+        simpleButton_Private_Do_Released(self_public, keyOwner);
 #endif /* defined(SIMPLEBTN_DEBUG) */
 
     }
@@ -195,43 +668,65 @@ simpleButton_Private_StateWaitForEnd_Handler(
 SIMPLEBTN_FORCE_INLINE void
 simpleButton_Private_StateWaitForRepeat_Handler(
     simpleButton_Type_PrivateBtnStatus_t* const self_private,
-    simpleButton_Type_PublicBtnStatus_t* const self_public
+    simpleButton_Type_PublicBtnStatus_t* const self_public,
+    simpleButton_Type_RepeatPushCallBack_t repeatPushCallBack
 ) {
+#if SIMPLEBTN_MODE_ENABLE_LOCKFREE_HANDOFF == 0
     SIMPLEBTN_FUNC_CRITICAL_SECTION_END_M(); /* end multi-thread critical section */
     SIMPLEBTN_FUNC_CRITICAL_SECTION_BEGIN(); /* begin always critical section */
+#endif /* SIMPLEBTN_MODE_ENABLE_LOCKFREE_HANDOFF == 0 */
 
+    /* nobody listens to repeat-push, so there is nothing to wait for */
 #if SIMPLEBTN_MODE_ENABLE_ADJUSTABLE_TIME != 0
-    if (SIMPLEBTN_FUNC_GET_TICK() - self_private->timeStamp_loop > (uint32_t)self_public->repeatWindowTime)
+    if (repeatPushCallBack == 0
+        || SIMPLEBTN_FUNC_GET_TICK() - self_private->timeStamp_loop > (uint32_t)self_public->repeatWindowTime)
 #else
-    if (SIMPLEBTN_FUNC_GET_TICK() - self_private->timeStamp_loop > SIMPLEBTN_TIME_REPEAT_WINDOW)
+    if (repeatPushCallBack == 0
+        || SIMPLEBTN_FUNC_GET_TICK() - self_private->timeStamp_loop > SIMPLEBTN_TIME_REPEAT_WINDOW)
 #endif /* SIMPLEBTN_MODE_ENABLE_ADJUSTABLE_TIME != 0 */
     {
 
 #if SIMPLEBTN_MODE_ENABLE_COUNTER_REPEAT_PUSH == 0
-        self_private->state = simpleButton_State_Single_Push;
+        simpleButton_Private_LeaveWaiting(self_private, simpleButton_State_Single_Push);
 #else
         if (self_private->push_time == 1) {
-            self_private->state = simpleButton_State_Single_Push;
+            simpleButton_Private_LeaveWaiting(self_private, simpleButton_State_Single_Push);
         } else {
-            self_private->state = simpleButton_State_Repeat_Push;
+            simpleButton_Private_LeaveWaiting(self_private, simpleButton_State_Repeat_Push);
         }
 #endif /* SIMPLEBTN_MODE_ENABLE_COUNTER_REPEAT_PUSH == 0 */
 
     } /* end if */
 
+#if SIMPLEBTN_MODE_ENABLE_LOCKFREE_HANDOFF == 0
     SIMPLEBTN_FUNC_CRITICAL_SECTION_END(); /* end always critical section */
     SIMPLEBTN_FUNC_CRITICAL_SECTION_BEGIN_M(); /* begin multi-thread critical section */
+#endif /* SIMPLEBTN_MODE_ENABLE_LOCKFREE_HANDOFF == 0 */
 }
 
 /* a helper function */
 SIMPLEBTN_FORCE_INLINE void
 simpleButton_Private_Do_LongPush(
     simpleButton_Type_PrivateBtnStatus_t* const self_private,
-    simpleButton_Type_LongPushCallBack_t longPushCallBack
+    simpleButton_Type_LongPushCallBack_t longPushCallBack,
+    volatile uint16_t* const keyOwner
 ) {
 
-#if SIMPLEBTN_MODE_ENABLE_TIMER_LONG_PUSH == 0
+#if SIMPLEBTN_MODE_ENABLE_DEFERRED_CALLBACK != 0
+
+    if (longPushCallBack != 0) {
+ #if SIMPLEBTN_MODE_ENABLE_TIMER_LONG_PUSH == 0
+        (void)self_private;
+        simpleButton_Private_Defer(simpleButton_Deferred_NoArg, longPushCallBack, 0, keyOwner);
+ #else
+        simpleButton_Private_Defer(simpleButton_Deferred_TimeArg, (void (*)(void))longPushCallBack,
+            SIMPLEBTN_FUNC_GET_TICK() - self_private->timeStamp_interrupt, keyOwner);
+ #endif /* SIMPLEBTN_MODE_ENABLE_TIMER_LONG_PUSH == 0 */
+    }
+
+#elif SIMPLEBTN_MODE_ENABLE_TIMER_LONG_PUSH == 0
     (void)self_private;
+    (void)keyOwner;
     SIMPLEBTN_FUNC_CRITICAL_SECTION_END_M(); /* end multi-thread critical section */
     if (longPushCallBack != 0) {
         longPushCallBack();
@@ -239,24 +734,33 @@ simpleButton_Private_Do_LongPush(
     SIMPLEBTN_FUNC_CRITICAL_SECTION_BEGIN_M(); /* begin multi-thread critical section */
 #else
     uint32_t longPushTime = SIMPLEBTN_FUNC_GET_TICK() - self_private->timeStamp_interrupt;
+    (void)keyOwner;
     SIMPLEBTN_FUNC_CRITICAL_SECTION_END_M(); /* end multi-thread critical section */
     if (longPushCallBack != 0) {
         longPushCallBack(longPushTime);
     }
     SIMPLEBTN_FUNC_CRITICAL_SECTION_BEGIN_M(); /* begin multi-thread critical section */
-#endif /* SIMPLEBTN_MODE_ENABLE_TIMER_LONG_PUSH == 0 */
+#endif /* SIMPLEBTN_MODE_ENABLE_DEFERRED_CALLBACK != 0 */
 
 }
 
 SIMPLEBTN_FORCE_INLINE void
 simpleButton_Private_Do_ShortPush(
-    simpleButton_Type_ShortPushCallBack_t shortPushCallBack
+    simpleButton_Type_ShortPushCallBack_t shortPushCallBack,
+    volatile uint16_t* const keyOwner
 ) {
+#if SIMPLEBTN_MODE_ENABLE_DEFERRED_CALLBACK != 0
+    if (shortPushCallBack != 0) {
+        simpleButton_Private_Defer(simpleButton_Deferred_NoArg, shortPushCallBack, 0, keyOwner);
+    }
+#else
+    (void)keyOwner;
     SIMPLEBTN_FUNC_CRITICAL_SECTION_END_M(); /* end multi-thread critical section */
     if (shortPushCallBack != 0) {
         shortPushCallBack();
     }
     SIMPLEBTN_FUNC_CRITICAL_SECTION_BEGIN_M(); /* begin multi-thread critical section */
+#endif /* SIMPLEBTN_MODE_ENABLE_DEFERRED_CALLBACK != 0 */
 }
 
 SIMPLEBTN_FORCE_INLINE void
@@ -264,7 +768,8 @@ simpleButton_Private_StateSinglePush_Handler(
     simpleButton_Type_PrivateBtnStatus_t* const self_private,
     simpleButton_Type_PublicBtnStatus_t* const self_public,
     simpleButton_Type_ShortPushCallBack_t shortPushCallBack,
-    simpleButton_Type_LongPushCallBack_t longPushCallBack
+    simpleButton_Type_LongPushCallBack_t longPushCallBack,
+    volatile uint16_t* const keyOwner
 ) {
     
 #if SIMPLEBTN_MODE_ENABLE_ADJUSTABLE_TIME != 0
@@ -273,9 +778,11 @@ simpleButton_Private_StateSinglePush_Handler(
     if (SIMPLEBTN_FUNC_GET_TICK() - self_private->timeStamp_interrupt > SIMPLEBTN_TIME_LONG_PUSH_MIN)
 #endif /* SIMPLEBTN_MODE_ENABLE_ADJUSTABLE_TIME != 0 */
     {
-        simpleButton_Private_Do_LongPush(self_private, longPushCallBack);
+        simpleButton_Private_Publish(self_private, 0, SimpleButton_Event_LongPush);
+        simpleButton_Private_Do_LongPush(self_private, longPushCallBack, keyOwner);
     } else {
-        simpleButton_Private_Do_ShortPush(shortPushCallBack);
+        simpleButton_Private_Publish(self_private, 0, SimpleButton_Event_ShortPush);
+        simpleButton_Private_Do_ShortPush(shortPushCallBack, keyOwner);
     }
 
     self_private->push_time = 0;
@@ -286,21 +793,42 @@ simpleButton_Private_StateSinglePush_Handler(
 SIMPLEBTN_FORCE_INLINE void
 simpleButton_Private_StateRepeatPush_Handler(
     simpleButton_Type_PrivateBtnStatus_t* const self_private,
-    simpleButton_Type_RepeatPushCallBack_t repeatPushCallBack
+    simpleButton_Type_RepeatPushCallBack_t repeatPushCallBack,
+    volatile uint16_t* const keyOwner
 ) {
+    simpleButton_Private_Publish(self_private, 0, SimpleButton_Event_RepeatPush);
+
+#if SIMPLEBTN_MODE_ENABLE_DEFERRED_CALLBACK != 0
+
+    if (repeatPushCallBack != 0) {
+
+ #if SIMPLEBTN_MODE_ENABLE_COUNTER_REPEAT_PUSH == 0
+        simpleButton_Private_Defer(simpleButton_Deferred_NoArg, repeatPushCallBack, 0, keyOwner);
+ #else
+        simpleButton_Private_Defer(simpleButton_Deferred_CountArg, (void (*)(void))repeatPushCallBack,
+            self_private->push_time, keyOwner);
+ #endif /* SIMPLEBTN_MODE_ENABLE_COUNTER_REPEAT_PUSH == 0 */
+
+    } /* end if */
+
+#else
+
+    (void)keyOwner;
     SIMPLEBTN_FUNC_CRITICAL_SECTION_END_M(); /* end multi-thread critical section */
 
     if (repeatPushCallBack != 0) {
 
-#if SIMPLEBTN_MODE_ENABLE_COUNTER_REPEAT_PUSH == 0
+ #if SIMPLEBTN_MODE_ENABLE_COUNTER_REPEAT_PUSH == 0
         repeatPushCallBack();
-#else
+ #else
         repeatPushCallBack(self_private->push_time);
-#endif /* SIMPLEBTN_MODE_ENABLE_COUNTER_REPEAT_PUSH == 0 */
+ #endif /* SIMPLEBTN_MODE_ENABLE_COUNTER_REPEAT_PUSH == 0 */
 
     } /* end if */
 
     SIMPLEBTN_FUNC_CRITICAL_SECTION_BEGIN_M(); /* begin multi-thread critical section */
+
+#endif /* SIMPLEBTN_MODE_ENABLE_DEFERRED_CALLBACK != 0 */
     self_private->push_time = 0;
     self_private->timeStamp_loop = SIMPLEBTN_FUNC_GET_TICK();
     self_private->state = simpleButton_State_Cool_Down;
@@ -327,11 +855,33 @@ simpleButton_Private_CmbBtnAfterReleaseOK(
         }
     }
 
-    self_private->state = simpleButton_State_Combination_Push;
+    simpleButton_Private_LeaveWaiting(self_private, simpleButton_State_Combination_Push);
 
 #endif /* SIMPLEBTN_MODE_ENABLE_COMBINATION != 0 */
 }
 
+/* a helper function : the push count that ends the repeat-push window at once */
+SIMPLEBTN_FORCE_INLINE uint8_t
+simpleButton_Private_RepeatMaxCount(
+    simpleButton_Type_PublicBtnStatus_t* const self_public
+) {
+#if SIMPLEBTN_MODE_ENABLE_ADJUSTABLE_TIME != 0
+    uint8_t max_count = self_public->repeatMaxCount;
+#else
+    uint8_t max_count = SIMPLEBTN_REPEAT_MAX_COUNT;
+    (void)self_public;
+#endif /* SIMPLEBTN_MODE_ENABLE_ADJUSTABLE_TIME != 0 */
+
+    /* enable counter-repeat-push or not */
+#if SIMPLEBTN_MODE_ENABLE_COUNTER_REPEAT_PUSH == 0
+    if (max_count > 2) {
+        max_count = 2; /* the repeat-push callback can not tell more */
+    }
+#endif /* SIMPLEBTN_MODE_ENABLE_COUNTER_REPEAT_PUSH == 0 */
+
+    return max_count;
+}
+
 /* a helper function */
 SIMPLEBTN_FORCE_INLINE void
 simpleButton_Private_ReleaseOK(
@@ -341,14 +891,13 @@ simpleButton_Private_ReleaseOK(
     self_private->push_time ++;
     self_private->timeStamp_loop = SIMPLEBTN_FUNC_GET_TICK();
 
-    /* enable counter-repeat-push or not */
-#if SIMPLEBTN_MODE_ENABLE_COUNTER_REPEAT_PUSH == 0
-    self_private->state = (self_private->push_time == 1)
-        ? simpleButton_State_Wait_For_Repeat : simpleButton_State_Repeat_Push;
-#else
-    self_private->state = (self_private->push_time < 0xFF)
-        ? simpleButton_State_Wait_For_Repeat : simpleButton_State_Repeat_Push;
-#endif /* SIMPLEBTN_MODE_ENABLE_COUNTER_REPEAT_PUSH == 0 */
+    /* decide at once if the max push count has been reached */
+    if (self_private->push_time < simpleButton_Private_RepeatMaxCount(self_public)) {
+        self_private->state = simpleButton_State_Wait_For_Repeat;
+    } else {
+        self_private->state = (self_private->push_time == 1)
+            ? simpleButton_State_Single_Push : simpleButton_State_Repeat_Push;
+    }
 
     simpleButton_Private_CmbBtnAfterReleaseOK(self_private, self_public);
 }
@@ -358,16 +907,29 @@ SIMPLEBTN_FORCE_INLINE void
 simpleButton_Private_StateReleaseDelay_Handler(
     simpleButton_Type_PrivateBtnStatus_t* const self_private,
     simpleButton_Type_PublicBtnStatus_t* const self_public,
-    const simpleButton_Type_GPIOBase_t gpiox_base,
-    const simpleButton_Type_GPIOPin_t  gpio_pin_x,
-    const simpleButton_Type_GPIOPinVal_t normal_pin_val
+    const uint8_t is_pushed,
+    volatile uint16_t* const keyOwner
 ) {
+#if SIMPLEBTN_MODE_ENABLE_ADAPTIVE_DEBOUNCE != 0
+    if (!simpleButton_Private_AdaptiveIsSettled(self_private, self_private->timeStamp_loop,
+            SIMPLEBTN_TIME_RELEASE_DELAY, self_private->settle_release, is_pushed)) {
+        return; /* still bouncing */
+    }
+
+    if (!is_pushed) {
+        simpleButton_Private_AdaptiveLearn(&(self_private->settle_release),
+            self_private->timeStamp_bounce - self_private->timeStamp_loop, SIMPLEBTN_TIME_RELEASE_DELAY);
+    }
+#else
     if (SIMPLEBTN_FUNC_GET_TICK() - self_private->timeStamp_loop <= SIMPLEBTN_TIME_RELEASE_DELAY) {
         return; /* still need wait */
     }
+#endif /* SIMPLEBTN_MODE_ENABLE_ADAPTIVE_DEBOUNCE != 0 */
 
-    if (SIMPLEBTN_FUNC_READ_PIN(gpiox_base, gpio_pin_x) == normal_pin_val) {
+    if (!is_pushed) {
         simpleButton_Private_ReleaseOK(self_private, self_public);
+        simpleButton_Private_Publish(self_private, 0, SimpleButton_Event_Released);
+        simpleButton_Private_Do_Released(self_public, keyOwner);
     } else {
         self_private->state = simpleButton_State_Wait_For_End;
     }
@@ -393,11 +955,20 @@ simpleButton_Private_StateCoolDown_Handler(
 SIMPLEBTN_FORCE_INLINE void
 simpleButton_Private_StateCombinationPush_Handler(
     simpleButton_Type_PrivateBtnStatus_t* const self_private,
-    simpleButton_Type_PublicBtnStatus_t* const self_public
+    simpleButton_Type_PublicBtnStatus_t* const self_public,
+    volatile uint16_t* const keyOwner
 ) {
     simpleButton_Type_CombinationPushCallBack_t cmbCallBack;
     cmbCallBack = self_public->combinationConfig.callBack;
 
+    simpleButton_Private_Publish(self_private, 0, SimpleButton_Event_CombinationPush);
+
+#if SIMPLEBTN_MODE_ENABLE_DEFERRED_CALLBACK != 0
+    if (cmbCallBack != 0) {
+        simpleButton_Private_Defer(simpleButton_Deferred_NoArg, cmbCallBack, 0, keyOwner);
+    }
+#else
+    (void)keyOwner;
     SIMPLEBTN_FUNC_CRITICAL_SECTION_END_M(); /* end multi-thread critical section */
 
     if (cmbCallBack != 0) {
@@ -405,6 +976,7 @@ simpleButton_Private_StateCombinationPush_Handler(
     }
 
     SIMPLEBTN_FUNC_CRITICAL_SECTION_BEGIN_M(); /* begin multi-thread critical section */
+#endif /* SIMPLEBTN_MODE_ENABLE_DEFERRED_CALLBACK != 0 */
     self_private->push_time = 0;
     self_private->timeStamp_loop = SIMPLEBTN_FUNC_GET_TICK();
     self_private->state = simpleButton_State_Cool_Down;
@@ -413,19 +985,23 @@ simpleButton_Private_StateCombinationPush_Handler(
 SIMPLEBTN_FORCE_INLINE void
 simpleButton_Private_StateCombinationWaitForEnd_Handler(
     simpleButton_Type_PrivateBtnStatus_t* const self_private,
-    const simpleButton_Type_GPIOBase_t gpiox_base,
-    const simpleButton_Type_GPIOPin_t  gpio_pin_x,
-    const simpleButton_Type_GPIOPinVal_t normal_pin_val
+    simpleButton_Type_PublicBtnStatus_t* const self_public,
+    const uint8_t is_pushed,
+    volatile uint16_t* const keyOwner
 ) {
-    if (SIMPLEBTN_FUNC_READ_PIN(gpiox_base, gpio_pin_x) == normal_pin_val) {
+    if (!is_pushed) {
         self_private->state = simpleButton_State_Combination_Release;
     } else if (SIMPLEBTN_FUNC_GET_TICK() - self_private->timeStamp_interrupt > SIMPLEBTN_TIME__TIMEOUT_COMBINATION) {
 
 #if defined(SIMPLEBTN_DEBUG)
+        (void)self_public;
+        (void)keyOwner;
         SIMPLEBTN_FUNC_PANIC("combination long push time out", simpleButton_ErrorNum_CmbPushTimeOut, );
 #else
         self_private->push_time = 0;
         self_private->state = simpleButton_State_Wait_For_Interrupt;
+        simpleButton_Private_Publish(self_private, 0, SimpleButton_Event_Released);
+        simpleButton_Private_Do_Released(self_public, keyOwner);
 #endif /* defined(SIMPLEBTN_DEBUG) */
 
     }
@@ -434,18 +1010,20 @@ simpleButton_Private_StateCombinationWaitForEnd_Handler(
 SIMPLEBTN_FORCE_INLINE void
 simpleButton_Private_StateCombinationRelease_Handler(
     simpleButton_Type_PrivateBtnStatus_t* const self_private,
-    const simpleButton_Type_GPIOBase_t gpiox_base,
-    const simpleButton_Type_GPIOPin_t  gpio_pin_x,
-    const simpleButton_Type_GPIOPinVal_t normal_pin_val
+    simpleButton_Type_PublicBtnStatus_t* const self_public,
+    const uint8_t is_pushed,
+    volatile uint16_t* const keyOwner
 ) {
     if (SIMPLEBTN_FUNC_GET_TICK() - self_private->timeStamp_loop <= SIMPLEBTN_TIME_RELEASE_DELAY) {
         return; /* still need wait */
     }
 
-    if (SIMPLEBTN_FUNC_READ_PIN(gpiox_base, gpio_pin_x) == normal_pin_val) {
+    if (!is_pushed) {
         self_private->push_time = 0;
         self_private->timeStamp_loop = SIMPLEBTN_FUNC_GET_TICK();
         self_private->state = simpleButton_State_Cool_Down;
+        simpleButton_Private_Publish(self_private, 0, SimpleButton_Event_Released);
+        simpleButton_Private_Do_Released(self_public, keyOwner);
     } else {
         self_private->state = simpleButton_State_Combination_WaitForEnd;
     }
@@ -459,18 +1037,18 @@ simpleButton_Private_StateCombinationRelease_Handler(
 SIMPLEBTN_FORCE_INLINE void
 simpleButton_Private_StateHoldPush_Handler(
     simpleButton_Type_PrivateBtnStatus_t* const self_private,
-    const simpleButton_Type_GPIOBase_t gpiox_base,
-    const simpleButton_Type_GPIOPin_t  gpio_pin_x,
-    const simpleButton_Type_GPIOPinVal_t normal_pin_val,
-    const simpleButton_Type_LongPushCallBack_t longPushCallBack
+    const uint8_t is_pushed,
+    const simpleButton_Type_LongPushCallBack_t longPushCallBack,
+    volatile uint16_t* const keyOwner
 ) {
-    if (SIMPLEBTN_FUNC_READ_PIN(gpiox_base, gpio_pin_x) == normal_pin_val) {
+    if (!is_pushed) {
         self_private->timeStamp_loop = SIMPLEBTN_FUNC_GET_TICK();
         self_private->state = simpleButton_State_Hold_Release;
     }
 
     if (SIMPLEBTN_FUNC_GET_TICK() - self_private->timeStamp_loop > SIMPLEBTN_TIME_HOLD_INTERVAL) {
-        simpleButton_Private_Do_LongPush(self_private, longPushCallBack);
+        simpleButton_Private_Publish(self_private, is_pushed, SimpleButton_Event_LongPush);
+        simpleButton_Private_Do_LongPush(self_private, longPushCallBack, keyOwner);
         self_private->timeStamp_loop = SIMPLEBTN_FUNC_GET_TICK();
     }
 }
@@ -478,18 +1056,20 @@ simpleButton_Private_StateHoldPush_Handler(
 SIMPLEBTN_FORCE_INLINE void
 simpleButton_Private_StateHoldRelease_Handler(
     simpleButton_Type_PrivateBtnStatus_t* const self_private,
-    const simpleButton_Type_GPIOBase_t gpiox_base,
-    const simpleButton_Type_GPIOPin_t  gpio_pin_x,
-    const simpleButton_Type_GPIOPinVal_t normal_pin_val
+    simpleButton_Type_PublicBtnStatus_t* const self_public,
+    const uint8_t is_pushed,
+    volatile uint16_t* const keyOwner
 ) {
     if (SIMPLEBTN_FUNC_GET_TICK() - self_private->timeStamp_loop <= SIMPLEBTN_TIME_RELEASE_DELAY) {
         return; /* still need wait */
     }
 
-    if (SIMPLEBTN_FUNC_READ_PIN(gpiox_base, gpio_pin_x) == normal_pin_val) {
+    if (!is_pushed) {
         self_private->push_time = 0;
         self_private->timeStamp_loop = SIMPLEBTN_FUNC_GET_TICK();
         self_private->state = simpleButton_State_Cool_Down;
+        simpleButton_Private_Publish(self_private, 0, SimpleButton_Event_Released);
+        simpleButton_Private_Do_Released(self_public, keyOwner);
     } else {
         self_private->state = simpleButton_State_Hold_Push;
     }
@@ -514,61 +1094,29 @@ simpleButton_Private_StateDefault_Handler(
 }
 
 /**
- * @brief           Asynchronously call the callback function in while loop.
+ * @brief           Run the button state machine with the sampled level of the button.
+ *                  (called in multi-thread critical section)
  * 
  * @param[inout]    self_private - pointer to self.Private struct.
  * @param[inout]    self_public - pointer to self.Public struct.
- * @param[in]       gpiox_base - Address of GPIO port connected to the button.
- * @param[in]       gpio_pin_x - GPIO pin number connected to the button.
- * @param[in]       normal_pin_val - Normal(didn't push) pin value of button pin. (can be 1 or 0)
+ * @param[in]       is_pushed - Non-zero if the button is pushed now.
  * @param[in]       shortPushCB - callback function for short push.
  * @param[in]       longPushCB - callback function for long push.
  * @param[in]       repeatPushCB - callback function for repeat push.
+ * @param[in]       keyOwner - The `currentKey` of the scan engine, or 0.
  * 
  * @return          None
- * 
- * @note            This function is one of the most important functions in the 
- *                  Simple-Button project. It is precisely this function that actually 
- *                  handles the scheduling and processing of the button state machine.
- * 
- *                  However, we do not recommend that users use this function directly 
- *                  unless you are fully aware of what you are doing.
  */
-SIMPLEBTN_C_API HOT_ void
-simpleButton_Private_AsynchronousHandler(
+SIMPLEBTN_FORCE_INLINE void
+simpleButton_Private_StateMachine(
     simpleButton_Type_PrivateBtnStatus_t* const self_private,
     simpleButton_Type_PublicBtnStatus_t* const self_public,
-    const simpleButton_Type_GPIOBase_t gpiox_base,
-    const simpleButton_Type_GPIOPin_t  gpio_pin_x,
-    const simpleButton_Type_GPIOPinVal_t normal_pin_val,
+    const uint8_t is_pushed,
     simpleButton_Type_ShortPushCallBack_t shortPushCB,
     simpleButton_Type_LongPushCallBack_t longPushCB,
-    simpleButton_Type_RepeatPushCallBack_t repeatPushCB
+    simpleButton_Type_RepeatPushCallBack_t repeatPushCB,
+    volatile uint16_t* const keyOwner
 ) {
-
-#if defined(SIMPLEBTN_DEBUG)
-
-    /* check the input */
-    if (0 == self_private || 0 == self_public) {
-        SIMPLEBTN_FUNC_PANIC(
-            "invalid input in func:simpleButton_Private_AsynchronousHandler", 
-            simpleButton_ErrorNum_invalidInput, 
-        );
-    }
-
-    /* check the flag */
-    if (self_private->is_init != SIMPLEBTN_IS_INIT_) {
-        SIMPLEBTN_FUNC_PANIC(
-            "the button has not be initialized yet",
-            simpleButton_ErrorNum_NoInit, 
-        );
-    }
-
-#endif /* defined(SIMPLEBTN_DEBUG) */
-
-
-    SIMPLEBTN_FUNC_CRITICAL_SECTION_BEGIN_M(); /* begin multi-thread critical section */
-
     switch ( (simpleButton_Type_ButtonState_t)(self_private->state) ) {
     case simpleButton_State_Wait_For_Interrupt: {
         simpleButton_Private_StateWaitForInterrupt_Handler();
@@ -576,32 +1124,32 @@ simpleButton_Private_AsynchronousHandler(
     }
 
     case simpleButton_State_Push_Delay: {
-        simpleButton_Private_StatePushDelay_Handler(self_private, gpiox_base, gpio_pin_x, normal_pin_val);
+        simpleButton_Private_StatePushDelay_Handler(self_private, self_public, is_pushed, keyOwner);
         break;
     }
 
     case simpleButton_State_Wait_For_End: {
-        simpleButton_Private_StateWaitForEnd_Handler(self_private, self_public, gpiox_base, gpio_pin_x, normal_pin_val, longPushCB);
+        simpleButton_Private_StateWaitForEnd_Handler(self_private, self_public, is_pushed, longPushCB, keyOwner);
         break;
     }
 
     case simpleButton_State_Wait_For_Repeat: {
-        simpleButton_Private_StateWaitForRepeat_Handler(self_private, self_public);
+        simpleButton_Private_StateWaitForRepeat_Handler(self_private, self_public, repeatPushCB);
         break;
     }
 
     case simpleButton_State_Single_Push: {
-        simpleButton_Private_StateSinglePush_Handler(self_private, self_public, shortPushCB, longPushCB);
+        simpleButton_Private_StateSinglePush_Handler(self_private, self_public, shortPushCB, longPushCB, keyOwner);
         break;
     }
 
     case simpleButton_State_Repeat_Push: {
-        simpleButton_Private_StateRepeatPush_Handler(self_private, repeatPushCB);
+        simpleButton_Private_StateRepeatPush_Handler(self_private, repeatPushCB, keyOwner);
         break;
     }
 
     case simpleButton_State_Release_Delay: {
-        simpleButton_Private_StateReleaseDelay_Handler(self_private, self_public, gpiox_base, gpio_pin_x, normal_pin_val);
+        simpleButton_Private_StateReleaseDelay_Handler(self_private, self_public, is_pushed, keyOwner);
         break;
     }
 
@@ -613,17 +1161,17 @@ simpleButton_Private_AsynchronousHandler(
 #if SIMPLEBTN_MODE_ENABLE_COMBINATION != 0
 
     case simpleButton_State_Combination_Push: {
-        simpleButton_Private_StateCombinationPush_Handler(self_private, self_public);
+        simpleButton_Private_StateCombinationPush_Handler(self_private, self_public, keyOwner);
         break;
     }
 
     case simpleButton_State_Combination_WaitForEnd: {
-        simpleButton_Private_StateCombinationWaitForEnd_Handler(self_private, gpiox_base, gpio_pin_x, normal_pin_val);
+        simpleButton_Private_StateCombinationWaitForEnd_Handler(self_private, self_public, is_pushed, keyOwner);
         break;
     }
 
     case simpleButton_State_Combination_Release: {
-        simpleButton_Private_StateCombinationRelease_Handler(self_private, gpiox_base, gpio_pin_x, normal_pin_val);
+        simpleButton_Private_StateCombinationRelease_Handler(self_private, self_public, is_pushed, keyOwner);
         break;
     }
 
@@ -632,27 +1180,245 @@ simpleButton_Private_AsynchronousHandler(
 #if SIMPLEBTN_MODE_ENABLE_LONGPUSH_HOLD != 0
 
     case simpleButton_State_Hold_Push: {
-        simpleButton_Private_StateHoldPush_Handler(self_private, gpiox_base, gpio_pin_x, normal_pin_val, longPushCB);
+        simpleButton_Private_StateHoldPush_Handler(self_private, is_pushed, longPushCB, keyOwner);
         break;
     }
 
     case simpleButton_State_Hold_Release: {
-        simpleButton_Private_StateHoldRelease_Handler(self_private, gpiox_base, gpio_pin_x, normal_pin_val);
+        simpleButton_Private_StateHoldRelease_Handler(self_private, self_public, is_pushed, keyOwner);
         break;
     } 
 
 #endif /* SIMPLEBTN_MODE_ENABLE_LONGPUSH_HOLD != 0 */
 
+#if SIMPLEBTN_MODE_ENABLE_LOCKFREE_HANDOFF != 0
+
+    case simpleButton_State_Push_Claimed: {
+        break; /* the ISR is stamping the push, `Push_Delay` in the next pass */
+    }
+
+#endif /* SIMPLEBTN_MODE_ENABLE_LOCKFREE_HANDOFF != 0 */
+
     default: {
         simpleButton_Private_StateDefault_Handler(self_private);
         break;
     }
 
     } /* end switch */
+}
+
+/* a helper function : check the input and the flag in debug mode */
+SIMPLEBTN_FORCE_INLINE void
+simpleButton_Private_DebugCheck(
+    const simpleButton_Type_PrivateBtnStatus_t* const self_private,
+    const simpleButton_Type_PublicBtnStatus_t* const self_public,
+    const char* const invalidInputCause
+) {
+#if defined(SIMPLEBTN_DEBUG)
+
+    /* check the input */
+    if (0 == self_private || 0 == self_public) {
+        SIMPLEBTN_FUNC_PANIC(
+            invalidInputCause, 
+            simpleButton_ErrorNum_invalidInput, 
+        );
+    }
+
+    /* check the flag */
+    if (self_private->is_init != SIMPLEBTN_IS_INIT_) {
+        SIMPLEBTN_FUNC_PANIC(
+            "the button has not be initialized yet",
+            simpleButton_ErrorNum_NoInit, 
+        );
+    }
+
+#else
+    (void)self_private;
+    (void)self_public;
+    (void)invalidInputCause;
+#endif /* defined(SIMPLEBTN_DEBUG) */
+}
+
+/**
+ * @brief           Asynchronously call the callback function in while loop.
+ * 
+ * @param[inout]    self_private - pointer to self.Private struct.
+ * @param[inout]    self_public - pointer to self.Public struct.
+ * @param[in]       gpiox_base - Address of GPIO port connected to the button.
+ * @param[in]       gpio_pin_x - GPIO pin number connected to the button.
+ * @param[in]       normal_pin_val - Normal(didn't push) pin value of button pin. (can be 1 or 0)
+ * @param[in]       shortPushCB - callback function for short push.
+ * @param[in]       longPushCB - callback function for long push.
+ * @param[in]       repeatPushCB - callback function for repeat push.
+ * 
+ * @return          None
+ * 
+ * @note            This function is one of the most important functions in the 
+ *                  Simple-Button project. It is precisely this function that actually 
+ *                  handles the scheduling and processing of the button state machine.
+ * 
+ *                  However, we do not recommend that users use this function directly 
+ *                  unless you are fully aware of what you are doing.
+ */
+SIMPLEBTN_C_API HOT_ void
+simpleButton_Private_AsynchronousHandler(
+    simpleButton_Type_PrivateBtnStatus_t* const self_private,
+    simpleButton_Type_PublicBtnStatus_t* const self_public,
+    const simpleButton_Type_GPIOBase_t gpiox_base,
+    const simpleButton_Type_GPIOPin_t  gpio_pin_x,
+    const simpleButton_Type_GPIOPinVal_t normal_pin_val,
+    simpleButton_Type_ShortPushCallBack_t shortPushCB,
+    simpleButton_Type_LongPushCallBack_t longPushCB,
+    simpleButton_Type_RepeatPushCallBack_t repeatPushCB
+) {
+    uint8_t is_pushed = 0;
+
+    simpleButton_Private_DebugCheck(self_private, self_public,
+        "invalid input in func:simpleButton_Private_AsynchronousHandler");
+
+    SIMPLEBTN_FUNC_CRITICAL_SECTION_BEGIN_M(); /* begin multi-thread critical section */
+
+    /* an idle EXTI button is woken up by interrupt, do not read the pin */
+    if ((simpleButton_Type_ButtonState_t)(self_private->state) != simpleButton_State_Wait_For_Interrupt) {
+        is_pushed = (uint8_t)(SIMPLEBTN_FUNC_READ_PIN(gpiox_base, gpio_pin_x) != normal_pin_val);
+    }
+
+    simpleButton_Private_StateMachine(self_private, self_public, is_pushed, shortPushCB, longPushCB, repeatPushCB, 0);
+
+    SIMPLEBTN_FUNC_CRITICAL_SECTION_END_M(); /* end multi-thread critical section */
+}
+
+/* a helper function : a polled button is "interrupted" by its level */
+SIMPLEBTN_FORCE_INLINE void
+simpleButton_Private_PolledTrigger(
+    simpleButton_Type_PrivateBtnStatus_t* const self_private,
+    const uint8_t is_pushed
+) {
+    simpleButton_Type_ButtonState_t state;
+
+    if (!is_pushed) {
+        return; /* didn't be pushed */
+    }
+
+    SIMPLEBTN_FUNC_CRITICAL_SECTION_BEGIN_H(); /* critical section begin (not in lock-free handoff mode) */
+
+    state = (simpleButton_Type_ButtonState_t)(self_private->state);
+    if (state == simpleButton_State_Wait_For_Interrupt || state == simpleButton_State_Wait_For_Repeat) {
+        simpleButton_Private_TakeOver(self_private, state, SIMPLEBTN_FUNC_GET_TICK());
+    }
+
+    SIMPLEBTN_FUNC_CRITICAL_SECTION_END_H(); /* critical section end (not in lock-free handoff mode) */
+}
+
+/**
+ * @brief           Handle a polled button (dynamic-button, key matrix, ...)
+ *                  with the level sampled by the caller.
+ * 
+ * @param[inout]    self_private - pointer to self.Private struct.
+ * @param[inout]    self_public - pointer to self.Public struct.
+ * @param[in]       is_pushed - Non-zero if the button is pushed now.
+ * @param[in]       shortPushCB - callback function for short push.
+ * @param[in]       longPushCB - callback function for long push.
+ * @param[in]       repeatPushCB - callback function for repeat push.
+ * @param[in]       currentKey - The `currentKey` of the scan engine, which holds
+ *                  the index of this key, or 0 if it is not a key of an engine.
+ * 
+ * @return          None
+ * 
+ * @note            Input sources which are not a single GPIO pin sample all
+ *                  of their keys at once, and feed each key in by this function.
+ */
+SIMPLEBTN_C_API HOT_ void
+simpleButton_Private_PolledHandler(
+    simpleButton_Type_PrivateBtnStatus_t* const self_private,
+    simpleButton_Type_PublicBtnStatus_t* const self_public,
+    const uint8_t is_pushed,
+    simpleButton_Type_ShortPushCallBack_t shortPushCB,
+    simpleButton_Type_LongPushCallBack_t longPushCB,
+    simpleButton_Type_RepeatPushCallBack_t repeatPushCB,
+    volatile uint16_t* const currentKey
+) {
+    simpleButton_Private_DebugCheck(self_private, self_public,
+        "invalid input in func:simpleButton_Private_PolledHandler");
+
+    simpleButton_Private_PolledTrigger(self_private, is_pushed);
+
+    SIMPLEBTN_FUNC_CRITICAL_SECTION_BEGIN_M(); /* begin multi-thread critical section */
+
+    simpleButton_Private_StateMachine(self_private, self_public, is_pushed, shortPushCB, longPushCB, repeatPushCB, currentKey);
 
     SIMPLEBTN_FUNC_CRITICAL_SECTION_END_M(); /* end multi-thread critical section */
 }
 
+/* a helper function : index of the lowest set bit (x != 0) */
+SIMPLEBTN_FORCE_INLINE uint8_t
+simpleButton_Private_LowestBit(uint32_t x)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return (uint8_t)__builtin_ctz(x);
+#else
+    uint8_t n = 0;
+    while ((x & 1U) == 0) {
+        x >>= 1;
+        n ++;
+    }
+    return n;
+#endif /* defined(__GNUC__) || defined(__clang__) */
+}
+
+/**
+ * @brief           Handle up to 32 virtual keys from one sampled word.
+ *
+ * @param[inout]    keys - The keys of bit 0 ~ 31.
+ * @param[in]       pushed - Bit N is set if key N is pushed.
+ * @param[in]       active - Bit N is set if key N is not idle.
+ * @param[in]       callBacks - The callback functions shared by the keys.
+ * @param[out]      currentKey - Set to `firstKey + N` before key N is handled.
+ * @param[in]       firstKey - The index of key 0 in its scan engine.
+ *
+ * @return          The new `active` word.
+ *
+ * @note            Only the pushed keys and the keys which are not idle are
+ *                  handled, idle keys cost nothing.
+ */
+SIMPLEBTN_C_API HOT_ uint32_t
+simpleButton_Private_ScanWord(
+    simpleButton_Type_VirtualKey_t* const keys,
+    const uint32_t pushed,
+    uint32_t active,
+    const simpleButton_Type_CallBackSet_t* const callBacks,
+    volatile uint16_t* const currentKey,
+    const uint16_t firstKey
+) {
+    uint32_t work = pushed | active;
+
+    while (work != 0) {
+        const uint8_t bit = simpleButton_Private_LowestBit(work);
+        simpleButton_Type_VirtualKey_t* const key = &(keys[bit]);
+
+        work &= work - 1U;
+
+        *currentKey = (uint16_t)(firstKey + bit);
+        simpleButton_Private_PolledHandler(
+            &(key->Private),
+            &(key->Public),
+            (uint8_t)((pushed >> bit) & 1U),
+            callBacks->shortPushCallBack,
+            callBacks->longPushCallBack,
+            callBacks->repeatPushCallBack,
+            currentKey
+        );
+
+        if ((simpleButton_Type_ButtonState_t)(key->Private.state) == simpleButton_State_Wait_For_Interrupt) {
+            active &= ~(1UL << bit);
+        } else {
+            active |= (1UL << bit);
+        }
+    }
+
+    return active;
+}
+
 /**
  * @brief           Initialize the dynamic-button.
  * 
@@ -681,28 +1447,15 @@ SimpleButton_DynamicButton_Init(
 
     simpleButton_Private_InitStructPublic(&(self->Public));
 
-    SIMPLEBTN_FUNC_CRITICAL_SECTION_END(); /* critical section end */
-}
-
-SIMPLEBTN_FORCE_INLINE void
-simpleButton_Private_DynamicBtn_CheckState(
-    SimpleButton_Type_DynamicBtn_t* const self
-) {
-    SIMPLEBTN_FUNC_CRITICAL_SECTION_BEGIN(); /* critical section begin */
-
-    if (
-        (simpleButton_Type_ButtonState_t)(self->Private.state) != simpleButton_State_Wait_For_Interrupt
-        && (simpleButton_Type_ButtonState_t)(self->Private.state) != simpleButton_State_Wait_For_Repeat
-    ) {
-        return; /* WFI or WFR is needed */
-    }
+#if SIMPLEBTN_MODE_ENABLE_ADAPTIVE_POLLING != 0
+    self->nextPollTick = SIMPLEBTN_FUNC_GET_TICK(); /* poll it at once */
+#endif /* SIMPLEBTN_MODE_ENABLE_ADAPTIVE_POLLING != 0 */
 
-    if (SIMPLEBTN_FUNC_READ_PIN(self->GPIO_Base, self->GPIO_Pin) == self->normalPinVal) {
-        return; /* didn't be pushed */
-    }
+#if SIMPLEBTN_MODE_ENABLE_REGISTRY != 0
+    simpleButton_Private_Registry_Add(&(self->Registry), 1);
+#endif /* SIMPLEBTN_MODE_ENABLE_REGISTRY != 0 */
 
-    self->Private.timeStamp_interrupt = SIMPLEBTN_FUNC_GET_TICK();
-    self->Private.state = simpleButton_State_Push_Delay;
+    simpleButton_Private_TimerWake(); /* a dynamic-button is polled by the timer */
 
     SIMPLEBTN_FUNC_CRITICAL_SECTION_END(); /* critical section end */
 }
@@ -716,6 +1469,11 @@ simpleButton_Private_DynamicBtn_CheckState(
  * @param[in]       repeatPushCallBack - callback function for repeat push.
  * 
  * @return          None
+ * 
+ * @note            In adaptive polling mode, an idle button is only polled
+ *                  every `SIMPLEBTN_TIME_IDLE_POLL_INTERVAL` ms, and the calls
+ *                  between are returned at once. Once it is pushed, it is
+ *                  polled at every call until it is idle again.
  */
 SIMPLEBTN_C_API HOT_ void
 SimpleButton_DynamicButton_Handler(
@@ -724,17 +1482,608 @@ SimpleButton_DynamicButton_Handler(
     simpleButton_Type_LongPushCallBack_t longPushCallBack,
     simpleButton_Type_RepeatPushCallBack_t repeatPushCallBack
 ) {
+    uint8_t is_pushed;
+
+#if SIMPLEBTN_MODE_ENABLE_ADAPTIVE_POLLING != 0
+    const uint32_t now = SIMPLEBTN_FUNC_GET_TICK();
+
+    if ((simpleButton_Type_ButtonState_t)(self->Private.state) == simpleButton_State_Wait_For_Interrupt
+        && (int32_t)(now - self->nextPollTick) < 0
+    ) {
+        return; /* idle, and the next slow poll is not due */
+    }
+#endif /* SIMPLEBTN_MODE_ENABLE_ADAPTIVE_POLLING != 0 */
 
-    simpleButton_Private_DynamicBtn_CheckState(self);
+    /* read the pin only once for each call */
+    is_pushed = (uint8_t)(SIMPLEBTN_FUNC_READ_PIN(self->GPIO_Base, self->GPIO_Pin) != self->normalPinVal);
 
-    simpleButton_Private_AsynchronousHandler(
+    simpleButton_Private_PolledHandler(
         &(self->Private),
         &(self->Public),
-        self->GPIO_Base,
-        self->GPIO_Pin,
-        self->normalPinVal,
+        is_pushed,
         shortPushCallBack,
         longPushCallBack,
-        repeatPushCallBack
+        repeatPushCallBack,
+        0
     );
+
+#if SIMPLEBTN_MODE_ENABLE_ADAPTIVE_POLLING != 0
+    /* back to the slow rate when it is idle, full rate otherwise.
+        The slow polls are aligned to the interval, so idle buttons share their wakeups. */
+    self->nextPollTick = ((simpleButton_Type_ButtonState_t)(self->Private.state) == simpleButton_State_Wait_For_Interrupt)
+        ? now - (now % SIMPLEBTN_TIME_IDLE_POLL_INTERVAL) + SIMPLEBTN_TIME_IDLE_POLL_INTERVAL
+        : now;
+#endif /* SIMPLEBTN_MODE_ENABLE_ADAPTIVE_POLLING != 0 */
+}
+
+#if SIMPLEBTN_MODE_ENABLE_ADAPTIVE_POLLING != 0
+
+/**
+ * @brief           Get the time until the dynamic-button has to be polled.
+ * 
+ * @param[in]       self - The pointer of dynamic-button object.
+ * 
+ * @return          The time in ms, 0 if it has to be polled now (it is not
+ *                  idle, or its slow poll is due).
+ */
+SIMPLEBTN_C_API uint32_t
+SimpleButton_DynamicButton_NextPoll(
+    const SimpleButton_Type_DynamicBtn_t* const self
+) {
+    const int32_t remain = (int32_t)(self->nextPollTick - SIMPLEBTN_FUNC_GET_TICK());
+
+    if ((simpleButton_Type_ButtonState_t)(self->Private.state) != simpleButton_State_Wait_For_Interrupt
+        || remain <= 0
+    ) {
+        return 0;
+    }
+
+    return (uint32_t)remain;
+}
+
+#endif /* SIMPLEBTN_MODE_ENABLE_ADAPTIVE_POLLING != 0 */
+
+#if SIMPLEBTN_MODE_ENABLE_REGISTRY != 0
+
+/**
+ * @brief           Unlink the dynamic-button from the registry.
+ * 
+ * @param[inout]    self - The pointer of dynamic-button object.
+ * 
+ * @return          None
+ * 
+ * @note            Call this before a local dynamic-button goes out of scope.
+ *                  Do not call it while `SimpleButton_Registry_HandleAll()` is running.
+ */
+SIMPLEBTN_C_API void
+SimpleButton_DynamicButton_Deinit(
+    SimpleButton_Type_DynamicBtn_t* const self
+) {
+    simpleButton_Type_RegistryNode_t** link = &simpleButton_Private_RegistryHead;
+
+    SIMPLEBTN_FUNC_CRITICAL_SECTION_BEGIN(); /* critical section begin */
+
+    while (*link != 0) {
+        if (*link == &(self->Registry)) {
+            *link = self->Registry.next;
+            break;
+        }
+        link = &((*link)->next);
+    }
+
+    if (simpleButton_Private_RegistryBusyCursor == &(self->Registry)) {
+        simpleButton_Private_RegistryBusyCursor = self->Registry.next;
+    }
+    if (simpleButton_Private_RegistryPollCursor == &(self->Registry)) {
+        simpleButton_Private_RegistryPollCursor = self->Registry.next;
+    }
+    self->Registry.next = 0;
+
+    SIMPLEBTN_FUNC_CRITICAL_SECTION_END(); /* critical section end */
+}
+
+/* a helper function : the state of a registered button */
+SIMPLEBTN_FORCE_INLINE simpleButton_Type_ButtonState_t
+simpleButton_Private_Registry_State(
+    simpleButton_Type_RegistryNode_t* const node
+) {
+    const simpleButton_Type_PrivateBtnStatus_t* self_private = (node->is_dynamic)
+        ? &(SIMPLEBTN_REGISTRY_OWNER_(node, SimpleButton_Type_DynamicBtn_t)->Private)
+        : &(SIMPLEBTN_REGISTRY_OWNER_(node, simpleButton_Type_Button_t)->Private);
+
+    return (simpleButton_Type_ButtonState_t)(self_private->state);
+}
+
+/* a helper function : handle a registered button with its callback functions */
+SIMPLEBTN_FORCE_INLINE void
+simpleButton_Private_Registry_Handle(
+    simpleButton_Type_RegistryNode_t* const node
+) {
+    if (node->is_dynamic) {
+        SimpleButton_DynamicButton_Handler(
+            SIMPLEBTN_REGISTRY_OWNER_(node, SimpleButton_Type_DynamicBtn_t),
+            node->callBacks.shortPushCallBack,
+            node->callBacks.longPushCallBack,
+            node->callBacks.repeatPushCallBack
+        );
+    } else {
+        SIMPLEBTN_REGISTRY_OWNER_(node, simpleButton_Type_Button_t)->Methods.asynchronousHandler(
+            node->callBacks.shortPushCallBack,
+            node->callBacks.longPushCallBack,
+            node->callBacks.repeatPushCallBack
+        );
+    }
+}
+
+/**
+ * @brief           Handle every registered button (static and dynamic) with
+ *                  the callback functions set by `SIMPLEBTN__REGISTRY_SETCALLBACK()`.
+ * 
+ * @return          None
+ */
+SIMPLEBTN_C_API HOT_ void
+SimpleButton_Registry_HandleAll(void)
+{
+    simpleButton_Type_RegistryNode_t* node = simpleButton_Private_RegistryHead;
+
+    while (node != 0) {
+        /* read the next one first, the callback may deinit this button */
+        simpleButton_Type_RegistryNode_t* const next = node->next;
+
+        simpleButton_Private_Registry_Handle(node);
+
+        node = next;
+    }
+}
+
+/**
+ * @brief           Check whether all of the registered buttons are idle.
+ * 
+ * @return          Non-zero if all of them are in `Wait_For_Interrupt` state.
+ */
+SIMPLEBTN_C_API uint32_t
+SimpleButton_Registry_AllIdle(void)
+{
+    simpleButton_Type_RegistryNode_t* node = simpleButton_Private_RegistryHead;
+
+    for (; node != 0; node = node->next) {
+        if (simpleButton_Private_Registry_State(node) != simpleButton_State_Wait_For_Interrupt) {
+            return 0;
+        }
+    }
+
+    return 1;
+}
+
+ #if SIMPLEBTN_MODE_ENABLE_ADAPTIVE_POLLING != 0
+
+/**
+ * @brief           Get the time until some registered button has to be handled,
+ *                  so the MCU can sleep until then.
+ * 
+ * @return          The time in ms, 0 if some button has to be handled now, or
+ *                  `SIMPLEBTN_NEXT_POLL_NEVER` if all of them are idle EXTI
+ *                  buttons (only their interrupt can wake the MCU up).
+ * 
+ * @note            Sleep with interrupts disabled after the check, or an EXTI
+ *                  coming between them is handled only after the sleep.
+ */
+SIMPLEBTN_C_API uint32_t
+SimpleButton_Registry_NextPoll(void)
+{
+    simpleButton_Type_RegistryNode_t* node = simpleButton_Private_RegistryHead;
+    uint32_t next = SIMPLEBTN_NEXT_POLL_NEVER;
+
+    for (; node != 0; node = node->next) {
+        uint32_t due;
+
+        if (node->is_dynamic) {
+            due = SimpleButton_DynamicButton_NextPoll(
+                SIMPLEBTN_REGISTRY_OWNER_(node, SimpleButton_Type_DynamicBtn_t));
+        } else if (simpleButton_Private_Registry_State(node) != simpleButton_State_Wait_For_Interrupt) {
+            due = 0;
+        } else {
+            continue; /* woken up by EXTI */
+        }
+
+        if (due < next) {
+            next = due;
+            if (next == 0) {
+                break;
+            }
+        }
+    }
+
+    return next;
+}
+
+ #endif /* SIMPLEBTN_MODE_ENABLE_ADAPTIVE_POLLING != 0 */
+
+/* a helper function : end a call of `SimpleButton_Registry_HandleBudget()` */
+SIMPLEBTN_FORCE_INLINE uint32_t
+simpleButton_Private_Registry_BudgetEnd(
+    const uint32_t begin,
+    const uint32_t now,
+    const uint32_t is_overrun
+) {
+    const uint32_t used = now - begin;
+
+    simpleButton_Private_BudgetStats.calls ++;
+    if (is_overrun) {
+        simpleButton_Private_BudgetStats.overruns ++;
+    }
+    if (used > simpleButton_Private_BudgetStats.maxCallUs) {
+        simpleButton_Private_BudgetStats.maxCallUs = used;
+    }
+
+    return is_overrun;
+}
+
+/**
+ * @brief           Handle the registered buttons round robin, until `budgetUs`
+ *                  is used up, and resume from there in the next call.
+ * 
+ * @param[in]       budgetUs - The time budget of this call, in us.
+ * 
+ * @return          Non-zero if the budget was used up before all the buttons
+ *                  were handled.
+ * 
+ * @note            The buttons which are not idle (debounce, long push, repeat
+ *                  window... are timed) are handled first, then the idle
+ *                  dynamic-buttons are polled. An idle EXTI button has nothing
+ *                  to do until its interrupt comes, so it is skipped.
+ * 
+ *                  The budget is checked after each button, so a call takes at
+ *                  most `budgetUs` plus the slowest button and its callback.
+ *                  The time is read by `SIMPLEBTN_FUNC_GET_TIME_US_FromISR()`.
+ * 
+ *                  Do not mix it with `SimpleButton_Registry_HandleAll()`.
+ */
+SIMPLEBTN_C_API HOT_ uint32_t
+SimpleButton_Registry_HandleBudget(
+    uint32_t budgetUs
+) {
+    const uint32_t begin = SIMPLEBTN_FUNC_GET_TIME_US_FromISR();
+    simpleButton_Type_RegistryNode_t* const cursor = simpleButton_Private_RegistryBusyCursor;
+    simpleButton_Type_RegistryNode_t* node;
+    uint32_t now;
+    uint8_t round;
+
+    if (simpleButton_Private_BudgetStats.calls == 0) {
+        simpleButton_Private_BudgetLapBegin = begin; /* first call since the reset */
+    }
+
+    /* 1. the buttons with a deadline : from the cursor to the end, then from the head */
+    for (round = 0; round < 2; round++) {
+        node = (round == 0) ? cursor : simpleButton_Private_RegistryHead;
+
+        while (node != 0 && !(round != 0 && node == cursor)) {
+            /* read the next one first, the callback may deinit this button */
+            simpleButton_Type_RegistryNode_t* const next = node->next;
+
+            if (simpleButton_Private_Registry_State(node) != simpleButton_State_Wait_For_Interrupt) {
+                simpleButton_Private_Registry_Handle(node);
+
+                now = SIMPLEBTN_FUNC_GET_TIME_US_FromISR();
+                if (now - begin >= budgetUs) {
+                    simpleButton_Private_RegistryBusyCursor = next; /* the others go first next time */
+                    return simpleButton_Private_Registry_BudgetEnd(begin, now, 1);
+                }
+            }
+
+            node = next;
+        }
+    }
+
+    /* 2. poll the idle dynamic-buttons, from the cursor to the end of the lap */
+    node = (simpleButton_Private_RegistryPollCursor != 0)
+        ? simpleButton_Private_RegistryPollCursor : simpleButton_Private_RegistryHead;
+    while (node != 0) {
+        simpleButton_Type_RegistryNode_t* const next = node->next;
+
+        if (node->is_dynamic
+            && simpleButton_Private_Registry_State(node) == simpleButton_State_Wait_For_Interrupt
+        ) {
+            simpleButton_Private_Registry_Handle(node);
+
+            now = SIMPLEBTN_FUNC_GET_TIME_US_FromISR();
+            if (now - begin >= budgetUs && next != 0) {
+                simpleButton_Private_RegistryPollCursor = next;
+                return simpleButton_Private_Registry_BudgetEnd(begin, now, 1);
+            }
+        }
+
+        node = next;
+    }
+
+    /* a lap is done : every idle button has been polled once */
+    now = SIMPLEBTN_FUNC_GET_TIME_US_FromISR();
+    simpleButton_Private_BudgetStats.laps ++;
+    if (now - simpleButton_Private_BudgetLapBegin > simpleButton_Private_BudgetStats.maxLapUs) {
+        simpleButton_Private_BudgetStats.maxLapUs = now - simpleButton_Private_BudgetLapBegin;
+    }
+    simpleButton_Private_BudgetLapBegin = now;
+    simpleButton_Private_RegistryPollCursor = 0; /* the next lap starts from the head */
+
+    return simpleButton_Private_Registry_BudgetEnd(begin, now, 0);
+}
+
+/**
+ * @brief           Get the statistics of `SimpleButton_Registry_HandleBudget()`.
+ * 
+ * @return          The statistics since the last reset.
+ */
+SIMPLEBTN_C_API const SimpleButton_Type_BudgetStats_t*
+SimpleButton_Registry_BudgetStats(void)
+{
+    return &simpleButton_Private_BudgetStats;
+}
+
+/**
+ * @brief           Reset the statistics of `SimpleButton_Registry_HandleBudget()`.
+ * 
+ * @return          None
+ */
+SIMPLEBTN_C_API void
+SimpleButton_Registry_ResetBudgetStats(void)
+{
+    simpleButton_Private_BudgetStats.calls = 0;
+    simpleButton_Private_BudgetStats.overruns = 0;
+    simpleButton_Private_BudgetStats.laps = 0;
+    simpleButton_Private_BudgetStats.maxCallUs = 0;
+    simpleButton_Private_BudgetStats.maxLapUs = 0;
 }
+
+ #if SIMPLEBTN_MODE_ENABLE_TIMER_DRIVEN != 0
+
+/**
+ * @brief           Run the registered buttons, call it in the ISR of the
+ *                  periodic timer. (every `SIMPLEBTN_TIME_TIMER_PERIOD` ms)
+ * 
+ * @return          None
+ * 
+ * @note            Every button which is not idle, and every dynamic-button
+ *                  (it has no EXTI to wake it up), is stepped. Their callbacks
+ *                  are queued for `SimpleButton_Deferred_Drain()`. When all of
+ *                  the buttons are idle EXTI buttons, the timer is stopped with
+ *                  `SIMPLEBTN_FUNC_TIMER_STOP()`, and the next push (EXTI)
+ *                  starts it again with `SIMPLEBTN_FUNC_TIMER_START()`.
+ *                  In adaptive polling mode, when the dynamic-buttons are idle
+ *                  too, the timer is reloaded with `SIMPLEBTN_FUNC_TIMER_RELOAD()`
+ *                  to fire at their next slow poll instead of every period.
+ */
+SIMPLEBTN_C_API HOT_ void
+SimpleButton_TimerDriven_Handler(void)
+{
+    simpleButton_Type_RegistryNode_t* node = simpleButton_Private_RegistryHead;
+#if SIMPLEBTN_MODE_ENABLE_ADAPTIVE_POLLING != 0
+    uint32_t nextPoll;
+#else
+    uint8_t is_polled = 0;
+#endif /* SIMPLEBTN_MODE_ENABLE_ADAPTIVE_POLLING != 0 */
+
+    while (node != 0) {
+        simpleButton_Type_RegistryNode_t* const next = node->next;
+
+        if (node->is_dynamic) {
+#if SIMPLEBTN_MODE_ENABLE_ADAPTIVE_POLLING == 0
+            is_polled = 1;
+#endif /* SIMPLEBTN_MODE_ENABLE_ADAPTIVE_POLLING == 0 */
+            simpleButton_Private_Registry_Handle(node);
+        } else if (simpleButton_Private_Registry_State(node) != simpleButton_State_Wait_For_Interrupt) {
+            simpleButton_Private_Registry_Handle(node);
+        }
+
+        node = next;
+    }
+
+#if SIMPLEBTN_MODE_ENABLE_ADAPTIVE_POLLING != 0
+
+    SIMPLEBTN_FUNC_CRITICAL_SECTION_BEGIN(); /* critical section begin */
+
+    /* no EXTI can come between the check and the stop / reload */
+    nextPoll = SimpleButton_Registry_NextPoll();
+    if (nextPoll == SIMPLEBTN_NEXT_POLL_NEVER) {
+        if (simpleButton_Private_TimerRunning == 2) {
+            SIMPLEBTN_FUNC_TIMER_RELOAD(SIMPLEBTN_TIME_TIMER_PERIOD); /* the next start goes at the full rate */
+        }
+        simpleButton_Private_TimerRunning = 0;
+        SIMPLEBTN_FUNC_TIMER_STOP();
+    } else if (nextPoll > SIMPLEBTN_TIME_TIMER_PERIOD) {
+        simpleButton_Private_TimerRunning = 2; /* only idle dynamic-buttons : sleep until their slow poll */
+        SIMPLEBTN_FUNC_TIMER_RELOAD(nextPoll);
+    } else if (simpleButton_Private_TimerRunning == 2) {
+        simpleButton_Private_TimerRunning = 1;
+        SIMPLEBTN_FUNC_TIMER_RELOAD(SIMPLEBTN_TIME_TIMER_PERIOD);
+    }
+
+    SIMPLEBTN_FUNC_CRITICAL_SECTION_END(); /* critical section end */
+
+#else
+
+    if (is_polled) {
+        return; /* the dynamic-buttons must be polled */
+    }
+
+    SIMPLEBTN_FUNC_CRITICAL_SECTION_BEGIN(); /* critical section begin */
+
+    /* no EXTI can come between the check and the stop */
+    if (SimpleButton_Registry_AllIdle()) {
+        simpleButton_Private_TimerRunning = 0;
+        SIMPLEBTN_FUNC_TIMER_STOP();
+    }
+
+    SIMPLEBTN_FUNC_CRITICAL_SECTION_END(); /* critical section end */
+
+#endif /* SIMPLEBTN_MODE_ENABLE_ADAPTIVE_POLLING != 0 */
+}
+
+/**
+ * @brief           Check whether the periodic timer of timer-driven mode is running.
+ * 
+ * @return          Non-zero if it is running. (some button is not idle, or
+ *                  a dynamic-button is registered)
+ */
+SIMPLEBTN_C_API uint32_t
+SimpleButton_TimerDriven_IsRunning(void)
+{
+    return simpleButton_Private_TimerRunning;
+}
+
+ #endif /* SIMPLEBTN_MODE_ENABLE_TIMER_DRIVEN != 0 */
+
+ #if defined(SIMPLEBTN_REGISTRY_SECTION)
+
+/* Bounds of the registry section, provided by the linker */
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+extern void (* const __start_simplebtn_init[])(void) __attribute__((weak));
+extern void (* const __stop_simplebtn_init[])(void) __attribute__((weak));
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+/**
+ * @brief           Initialize every button created by `SIMPLEBTN__CREATE()`,
+ *                  in all translation units, without listing them.
+ * 
+ * @return          None
+ */
+SIMPLEBTN_C_API void
+SimpleButton_Registry_InitAll(void)
+{
+    void (* const * entry)(void) = __start_simplebtn_init;
+
+    for (; entry != 0 && entry < __stop_simplebtn_init; entry++) {
+        (*entry)();
+    }
+}
+
+ #endif /* defined(SIMPLEBTN_REGISTRY_SECTION) */
+
+#endif /* SIMPLEBTN_MODE_ENABLE_REGISTRY != 0 */
+
+#if SIMPLEBTN_MODE_ENABLE_SNAPSHOT != 0
+
+/**
+ * @brief           Read the snapshot of a button, without any critical section.
+ * 
+ * @param[in]       self_private - pointer to self.Private struct.
+ * @param[out]      snapshot - The copy of the snapshot.
+ * 
+ * @return          The sequence number of the snapshot, it moves on with every
+ *                  event, so a poller can tell whether anything happened.
+ * 
+ * @note            Can be called from any thread or ISR. An ISR (or a thread on the
+ *                  core of the while loop) never retries, a reader on another
+ *                  core retries only if an event is published during its copy.
+ */
+SIMPLEBTN_C_API uint32_t
+SimpleButton_Snapshot_Read(
+    const simpleButton_Type_PrivateBtnStatus_t* const self_private,
+    SimpleButton_Type_BtnSnapshot_t* const snapshot
+) {
+    uint32_t sequence;
+
+    for (;;) {
+        const volatile SimpleButton_Type_BtnSnapshot_t* slot;
+
+        sequence = self_private->snapshot.sequence;
+        SIMPLEBTN_FUNC_MEMORY_BARRIER(); /* the slot is read after its sequence */
+
+        slot = &(self_private->snapshot.slot[sequence & 1U]);
+        snapshot->pushTick = slot->pushTick;
+        snapshot->eventTick = slot->eventTick;
+        snapshot->is_held = slot->is_held;
+        snapshot->clickCount = slot->clickCount;
+        snapshot->lastEvent = slot->lastEvent;
+
+        SIMPLEBTN_FUNC_MEMORY_BARRIER(); /* the slot is read before the check */
+        if (self_private->snapshot.sequence == sequence) {
+            return sequence; /* nothing was published meanwhile */
+        }
+    }
+}
+
+#endif /* SIMPLEBTN_MODE_ENABLE_SNAPSHOT != 0 */
+
+#if SIMPLEBTN_MODE_ENABLE_DEFERRED_CALLBACK != 0
+
+/**
+ * @brief           Call the deferred callbacks, in the order of their events.
+ * 
+ * @return          The number of callbacks called.
+ * 
+ * @note            Call it from one context only, with a lower priority than the
+ *                  button handlers : the handler of `SIMPLEBTN_FUNC_DEFERRED_PEND()`
+ *                  (PendSV, software interrupt, worker thread...) or the idle loop.
+ *                  A slow callback then no longer delays the other buttons.
+ */
+SIMPLEBTN_C_API uint32_t
+SimpleButton_Deferred_Drain(void)
+{
+    uint32_t count = 0;
+
+    for (;;) {
+        const uint32_t position = simpleButton_Private_DeferredTail;
+        simpleButton_Type_DeferredCall_t* const call =
+            &(simpleButton_Private_DeferredQueue[position & SIMPLEBTN_DEFERRED_MASK_]);
+        simpleButton_Type_DeferredCall_t copy;
+
+        if (call->sequence != (position & ~SIMPLEBTN_DEFERRED_MASK_) + 1U) {
+            return count; /* empty (or the next one is still being written) */
+        }
+        SIMPLEBTN_FUNC_MEMORY_BARRIER(); /* the slot is read after it is marked full */
+
+        copy.kind = call->kind;
+        copy.func = call->func;
+        copy.arg = call->arg;
+        copy.key = call->key;
+
+        SIMPLEBTN_FUNC_MEMORY_BARRIER(); /* the slot is read before it is given back */
+        call->sequence = (position & ~SIMPLEBTN_DEFERRED_MASK_) + SIMPLEBTN_DEFERRED_QUEUE_SIZE;
+        simpleButton_Private_DeferredTail = position + 1U;
+
+        simpleButton_Private_DeferredCurrentKey = copy.key; /* not the engine's, the scanner writes it */
+
+        if (copy.kind == simpleButton_Deferred_TimeArg) {
+            copy.func.timeArg(copy.arg);
+        } else if (copy.kind == simpleButton_Deferred_CountArg) {
+            copy.func.countArg((uint8_t)copy.arg);
+        } else {
+            copy.func.noArg();
+        }
+
+        count ++;
+    }
+}
+
+/**
+ * @brief           Get the key of the deferred callback being called.
+ * 
+ * @return          The `currentKey` the scan engine had when the callback was
+ *                  queued. (0 for a button of no scan engine)
+ * 
+ * @note            The `CurrentKey()` of the scan engines returns it in deferred
+ *                  callback mode, as the scanner may handle other keys while the
+ *                  drain runs.
+ */
+SIMPLEBTN_C_API uint16_t
+SimpleButton_Deferred_CurrentKey(void)
+{
+    return simpleButton_Private_DeferredCurrentKey;
+}
+
+/**
+ * @brief           Get the number of callbacks dropped because the queue was full.
+ * 
+ * @return          The number of dropped callbacks. (`SIMPLEBTN_DEFERRED_QUEUE_SIZE` is too small)
+ */
+SIMPLEBTN_C_API uint32_t
+SimpleButton_Deferred_DropCount(void)
+{
+    return simpleButton_Private_DeferredDrops;
+}
+
+#endif /* SIMPLEBTN_MODE_ENABLE_DEFERRED_CALLBACK != 0 */
@@ -33,6 +33,78 @@
 #ifndef SIMPLEBTN_FUNC_GET_TICK_FromISR
  #define SIMPLEBTN_FUNC_GET_TICK_FromISR()  SIMPLEBTN_FUNC_GET_TICK()
 #endif /* SIMPLEBTN_FUNC_GET_TICK_FromISR */
+#ifndef SIMPLEBTN_FUNC_GET_TIME_US_FromISR
+ #define SIMPLEBTN_FUNC_GET_TIME_US_FromISR()   ((uint32_t)SIMPLEBTN_FUNC_GET_TICK_FromISR() * 1000U)
+#endif /* SIMPLEBTN_FUNC_GET_TIME_US_FromISR */
+#ifndef SIMPLEBTN_TIME_DEBOUNCE_MIN
+ #define SIMPLEBTN_TIME_DEBOUNCE_MIN        2
+#endif /* SIMPLEBTN_TIME_DEBOUNCE_MIN */
+#ifndef SIMPLEBTN_TIME_DEBOUNCE_MARGIN
+ #define SIMPLEBTN_TIME_DEBOUNCE_MARGIN     3
+#endif /* SIMPLEBTN_TIME_DEBOUNCE_MARGIN */
+#ifndef SIMPLEBTN_REPEAT_MAX_COUNT
+ #define SIMPLEBTN_REPEAT_MAX_COUNT         0xFF
+#endif /* SIMPLEBTN_REPEAT_MAX_COUNT */
+#ifndef SIMPLEBTN_TIME_GESTURE_TIMEOUT
+ #define SIMPLEBTN_TIME_GESTURE_TIMEOUT     1500
+#endif /* SIMPLEBTN_TIME_GESTURE_TIMEOUT */
+#ifndef SIMPLEBTN_TIME_CHORD_WINDOW
+ #define SIMPLEBTN_TIME_CHORD_WINDOW        50
+#endif /* SIMPLEBTN_TIME_CHORD_WINDOW */
+#ifndef SIMPLEBTN_FUNC_DEFERRED_PEND
+ #define SIMPLEBTN_FUNC_DEFERRED_PEND()
+#endif /* SIMPLEBTN_FUNC_DEFERRED_PEND */
+#ifndef SIMPLEBTN_DEFERRED_QUEUE_SIZE
+ #define SIMPLEBTN_DEFERRED_QUEUE_SIZE      16
+#endif /* SIMPLEBTN_DEFERRED_QUEUE_SIZE */
+#ifndef SIMPLEBTN_FUNC_TIMER_START
+ #define SIMPLEBTN_FUNC_TIMER_START()
+#endif /* SIMPLEBTN_FUNC_TIMER_START */
+#ifndef SIMPLEBTN_FUNC_TIMER_STOP
+ #define SIMPLEBTN_FUNC_TIMER_STOP()
+#endif /* SIMPLEBTN_FUNC_TIMER_STOP */
+#ifndef SIMPLEBTN_FUNC_TIMER_RELOAD
+ #define SIMPLEBTN_FUNC_TIMER_RELOAD(periodMs)
+#endif /* SIMPLEBTN_FUNC_TIMER_RELOAD */
+#ifndef SIMPLEBTN_TIME_TIMER_PERIOD
+ #define SIMPLEBTN_TIME_TIMER_PERIOD        1
+#endif /* SIMPLEBTN_TIME_TIMER_PERIOD */
+#ifndef SIMPLEBTN_TIME_IDLE_POLL_INTERVAL
+ #define SIMPLEBTN_TIME_IDLE_POLL_INTERVAL  20
+#endif /* SIMPLEBTN_TIME_IDLE_POLL_INTERVAL */
+
+/* Check the size of the deferred callback queue (the ring is indexed by mask) */
+#if SIMPLEBTN_MODE_ENABLE_DEFERRED_CALLBACK != 0
+ #if (SIMPLEBTN_DEFERRED_QUEUE_SIZE & (SIMPLEBTN_DEFERRED_QUEUE_SIZE - 1)) != 0 || SIMPLEBTN_DEFERRED_QUEUE_SIZE < 2
+  #error [Simple-Button] : SIMPLEBTN_DEFERRED_QUEUE_SIZE must be a power of 2.
+ #endif
+#endif /* SIMPLEBTN_MODE_ENABLE_DEFERRED_CALLBACK != 0 */
+
+/* Check the modes needed by timer-driven mode (the timer walks the registry, its callbacks are queued) */
+#if SIMPLEBTN_MODE_ENABLE_TIMER_DRIVEN != 0
+ #if SIMPLEBTN_MODE_ENABLE_REGISTRY == 0 || SIMPLEBTN_MODE_ENABLE_DEFERRED_CALLBACK == 0
+  #error [Simple-Button] : timer-driven mode needs registry mode and deferred callback mode.
+ #endif
+ #if SIMPLEBTN_MODE_ENABLE_MULTI_THREADS != 0
+  #error [Simple-Button] : timer-driven mode runs the state machine in the timer ISR,\
+ where the multi-thread critical section (a mutex on RTOS ports) must not be taken. Disable multi-thread mode.
+ #endif
+#endif /* SIMPLEBTN_MODE_ENABLE_TIMER_DRIVEN != 0 */
+
+/* Check the time for adaptive-debounce (the estimates are stored in uint8_t) */
+#if SIMPLEBTN_MODE_ENABLE_ADAPTIVE_DEBOUNCE != 0
+ #if (SIMPLEBTN_TIME_PUSH_DELAY > 255) || (SIMPLEBTN_TIME_RELEASE_DELAY > 255)
+  #error [Simple-Button] : adaptive-debounce needs push/release delay <= 255 ms.
+ #endif
+#endif /* SIMPLEBTN_MODE_ENABLE_ADAPTIVE_DEBOUNCE != 0 */
+
+/* Macro for linker-section registry (GNU toolchain with ELF output) */
+#if SIMPLEBTN_MODE_ENABLE_REGISTRY != 0
+ #if (defined(__GNUC__) || defined(__clang__)) && !defined(__ARMCC_VERSION) \
+    && !defined(__APPLE__) && !defined(_WIN32)
+  #define SIMPLEBTN_REGISTRY_SECTION
+ #endif
+#endif /* SIMPLEBTN_MODE_ENABLE_REGISTRY != 0 */
 
 /* Macro for bit-field */
 #define SIMPLEBTN_BITFIELD(type)                        uint32_t
@@ -51,6 +123,32 @@
  #define SIMPLEBTN_FUNC_CRITICAL_SECTION_END_M()
 #endif /* SIMPLEBTN_MODE_ENABLE_MULTI_THREADS == 1 */
 
+/* Macro for the ISR/loop handoff of the state (a CAS in lock-free handoff mode) */
+#if SIMPLEBTN_MODE_ENABLE_LOCKFREE_HANDOFF != 0
+ #define SIMPLEBTN_FUNC_CRITICAL_SECTION_BEGIN_H()
+ #define SIMPLEBTN_FUNC_CRITICAL_SECTION_END_H()
+#else
+ #define SIMPLEBTN_FUNC_CRITICAL_SECTION_BEGIN_H() SIMPLEBTN_FUNC_CRITICAL_SECTION_BEGIN()
+ #define SIMPLEBTN_FUNC_CRITICAL_SECTION_END_H() SIMPLEBTN_FUNC_CRITICAL_SECTION_END()
+#endif /* SIMPLEBTN_MODE_ENABLE_LOCKFREE_HANDOFF != 0 */
+
+/* Macro for compare-and-swap (lock-free handoff, deferred callback queue) */
+#if SIMPLEBTN_MODE_ENABLE_LOCKFREE_HANDOFF != 0 || SIMPLEBTN_MODE_ENABLE_DEFERRED_CALLBACK != 0
+ #if !defined(SIMPLEBTN_FUNC_COMPARE_AND_SWAP) && !defined(__GNUC__) && !defined(__clang__)
+  #error [Simple-Button] : lock-free handoff and deferred callback need SIMPLEBTN_FUNC_COMPARE_AND_SWAP() on this compiler.
+ #endif
+#endif /* SIMPLEBTN_MODE_ENABLE_LOCKFREE_HANDOFF != 0 || SIMPLEBTN_MODE_ENABLE_DEFERRED_CALLBACK != 0 */
+
+/* Macro for the lock-free publication (snapshot, deferred callback queue, handoff) */
+#if (SIMPLEBTN_MODE_ENABLE_SNAPSHOT != 0 || SIMPLEBTN_MODE_ENABLE_DEFERRED_CALLBACK != 0 \
+    || SIMPLEBTN_MODE_ENABLE_LOCKFREE_HANDOFF != 0) && !defined(SIMPLEBTN_FUNC_MEMORY_BARRIER)
+ #if defined(__GNUC__) || defined(__clang__)
+  #define SIMPLEBTN_FUNC_MEMORY_BARRIER()   __atomic_thread_fence(__ATOMIC_SEQ_CST)
+ #else
+  #error [Simple-Button] : snapshot, deferred callback and lock-free handoff need SIMPLEBTN_FUNC_MEMORY_BARRIER() on this compiler.
+ #endif
+#endif /* SIMPLEBTN_FUNC_MEMORY_BARRIER */
+
 /* Macro for C API */
 #ifdef __cplusplus
  #define SIMPLEBTN_C_API extern "C"
@@ -123,6 +221,12 @@ typedef void (* simpleButton_Type_ShortPushCallBack_t)(void);
  typedef void (* simpleButton_Type_CombinationPushCallBack_t)(void);
 #endif /* SIMPLEBTN_MODE_ENABLE_COMBINATION != 0 */
 
+/* Pressed/Released event callback function pointer Type */
+#if SIMPLEBTN_MODE_ENABLE_PRESS_RELEASE_EVENT != 0
+ typedef void (* simpleButton_Type_PressedCallBack_t)(void);
+ typedef void (* simpleButton_Type_ReleasedCallBack_t)(void);
+#endif /* SIMPLEBTN_MODE_ENABLE_PRESS_RELEASE_EVENT != 0 */
+
 typedef void (* simpleButton_Type_AsynchronousHandler_t)(
             simpleButton_Type_ShortPushCallBack_t shortPushCallBack,
             simpleButton_Type_LongPushCallBack_t longPushCallBack,
@@ -131,6 +235,47 @@ typedef void (* simpleButton_Type_AsynchronousHandler_t)(
 
 typedef void (* simpleButton_Type_InterruptHandler_t)(void);
 
+/* struct for the callback functions stored in the button. */
+typedef struct simpleButton_Type_CallBackSet_t {
+
+    simpleButton_Type_ShortPushCallBack_t shortPushCallBack;
+
+    simpleButton_Type_LongPushCallBack_t longPushCallBack;
+
+    simpleButton_Type_RepeatPushCallBack_t repeatPushCallBack;
+
+} simpleButton_Type_CallBackSet_t;
+
+#if SIMPLEBTN_MODE_ENABLE_REGISTRY != 0
+
+ /* intrusive list node, which links the button into the registry. */
+ typedef struct simpleButton_Type_RegistryNode_t {
+
+    struct simpleButton_Type_RegistryNode_t* next;
+
+    simpleButton_Type_CallBackSet_t callBacks;
+
+    uint8_t                         is_dynamic;
+
+ } simpleButton_Type_RegistryNode_t;
+
+ /* statistics of `SimpleButton_Registry_HandleBudget()` */
+ typedef struct SimpleButton_Type_BudgetStats_t {
+
+    uint32_t    calls;
+
+    uint32_t    overruns;   /* calls which used up the budget before all the buttons were handled */
+
+    uint32_t    laps;       /* times every idle button has been polled */
+
+    uint32_t    maxCallUs;  /* longest call : the budget plus the slowest button (and its callback) */
+
+    uint32_t    maxLapUs;   /* longest lap : the longest an idle button waited to be polled */
+
+ } SimpleButton_Type_BudgetStats_t;
+
+#endif /* SIMPLEBTN_MODE_ENABLE_REGISTRY != 0 */
+
 /**
  * @enum    simpleButton_Type_ButtonState_t
  * 
@@ -171,8 +316,68 @@ typedef enum simpleButton_Type_ButtonState_t {
 
 #endif /* SIMPLEBTN_MODE_ENABLE_LONGPUSH_HOLD != 0 */
 
+#if SIMPLEBTN_MODE_ENABLE_LOCKFREE_HANDOFF != 0
+
+    simpleButton_State_Push_Claimed, /* the ISR won the handoff, `Push_Delay` follows */
+
+#endif /* SIMPLEBTN_MODE_ENABLE_LOCKFREE_HANDOFF != 0 */
+
 } simpleButton_Type_ButtonState_t;
 
+/**
+ * @enum    SimpleButton_Type_BtnEvent_t
+ * 
+ * @brief   Enum for the events of a button. (the last event in a snapshot)
+ */
+typedef enum SimpleButton_Type_BtnEvent_t {
+    SimpleButton_Event_None = 0,
+
+    SimpleButton_Event_Pressed,
+
+    SimpleButton_Event_Released,
+
+    SimpleButton_Event_ShortPush,
+
+    SimpleButton_Event_LongPush,
+
+    SimpleButton_Event_RepeatPush,
+
+    SimpleButton_Event_CombinationPush,
+
+} SimpleButton_Type_BtnEvent_t;
+
+#if SIMPLEBTN_MODE_ENABLE_SNAPSHOT != 0
+
+/**
+ * @struct      SimpleButton_Type_BtnSnapshot_t
+ * 
+ * @brief       A consistent copy of what a button is doing, for reader threads / ISRs.
+ */
+typedef struct SimpleButton_Type_BtnSnapshot_t {
+
+    uint32_t                        pushTick; /* tick of the last (debounced) push */
+
+    uint32_t                        eventTick; /* tick of the last event */
+
+    uint8_t                         is_held; /* pushed now (debounced) */
+
+    uint8_t                         clickCount; /* clicks of the current (or last) click sequence */
+
+    uint8_t                         lastEvent; /* SimpleButton_Type_BtnEvent_t */
+
+} SimpleButton_Type_BtnSnapshot_t;
+
+/* The two slots of the snapshot, `slot[sequence & 1]` is the published one. */
+typedef struct simpleButton_Type_SnapshotBuffer_t {
+
+    volatile uint32_t               sequence;
+
+    volatile SimpleButton_Type_BtnSnapshot_t slot[2];
+
+} simpleButton_Type_SnapshotBuffer_t;
+
+#endif /* SIMPLEBTN_MODE_ENABLE_SNAPSHOT != 0 */
+
 /* struct for button private status. */
 typedef struct simpleButton_Type_PrivateBtnStatus_t {
 
@@ -180,12 +385,32 @@ typedef struct simpleButton_Type_PrivateBtnStatus_t {
 
     volatile uint32_t               timeStamp_interrupt; /* used in interrupt */
 
+#if SIMPLEBTN_MODE_ENABLE_LOCKFREE_HANDOFF != 0
+    volatile uint32_t               state; /* a whole word, for compare-and-swap */
+#else
     volatile SIMPLEBTN_BITFIELD (simpleButton_Type_ButtonState_t) state : 8;
+#endif /* SIMPLEBTN_MODE_ENABLE_LOCKFREE_HANDOFF != 0 */
 
     uint8_t                         push_time;
 
     uint8_t                         is_init;
 
+#if SIMPLEBTN_MODE_ENABLE_ADAPTIVE_DEBOUNCE != 0
+
+    volatile uint32_t               timeStamp_bounce; /* last edge seen while debouncing */
+
+    uint8_t                         bounce_level; /* last level seen while debouncing */
+
+    uint8_t                         settle_push; /* learned bounce time after push */
+
+    uint8_t                         settle_release; /* learned bounce time after release */
+
+#endif /* SIMPLEBTN_MODE_ENABLE_ADAPTIVE_DEBOUNCE != 0 */
+
+#if SIMPLEBTN_MODE_ENABLE_SNAPSHOT != 0
+    simpleButton_Type_SnapshotBuffer_t snapshot; /* published for reader threads / ISRs */
+#endif /* SIMPLEBTN_MODE_ENABLE_SNAPSHOT != 0 */
+
 } simpleButton_Type_PrivateBtnStatus_t;
 
 /* struct for combination status and config. */
@@ -202,6 +427,19 @@ typedef struct simpleButton_Type_PrivateBtnStatus_t {
 
 #endif /* SIMPLEBTN_MODE_ENABLE_COMBINATION != 0 */
 
+/* struct for pressed/released event config. */
+#if SIMPLEBTN_MODE_ENABLE_PRESS_RELEASE_EVENT != 0
+
+ typedef struct simpleButton_Type_EvtBtnConfig_t {
+
+    volatile simpleButton_Type_PressedCallBack_t pressedCallBack;
+
+    volatile simpleButton_Type_ReleasedCallBack_t releasedCallBack;
+
+ } simpleButton_Type_EvtBtnConfig_t;
+
+#endif /* SIMPLEBTN_MODE_ENABLE_PRESS_RELEASE_EVENT != 0 */
+
 /* struct for public status and config. */
 typedef struct simpleButton_Type_PublicBtnStatus_t {
 
@@ -209,6 +447,10 @@ typedef struct simpleButton_Type_PublicBtnStatus_t {
     simpleButton_Type_CmbBtnConfig_t combinationConfig;
 #endif /* SIMPLEBTN_MODE_ENABLE_COMBINATION != 0 */
 
+#if SIMPLEBTN_MODE_ENABLE_PRESS_RELEASE_EVENT != 0
+    simpleButton_Type_EvtBtnConfig_t eventConfig;
+#endif /* SIMPLEBTN_MODE_ENABLE_PRESS_RELEASE_EVENT != 0 */
+
 #if SIMPLEBTN_MODE_ENABLE_ADJUSTABLE_TIME != 0
 
  #if SIMPLEBTN_MODE_ENABLE_LONGPUSH_HOLD != 0
@@ -220,6 +462,7 @@ typedef struct simpleButton_Type_PublicBtnStatus_t {
     uint16_t                        longPushMinTime;
     uint16_t                        coolDownTime;
     uint16_t                        repeatWindowTime;
+    uint8_t                         repeatMaxCount;
 
 #endif /* SIMPLEBTN_MODE_ENABLE_ADJUSTABLE_TIME != 0 */
 } simpleButton_Type_PublicBtnStatus_t;
@@ -248,6 +491,10 @@ typedef struct simpleButton_Type_Button_t {
 
     simpleButton_Type_PrivateBtnStatus_t Private;
 
+#if SIMPLEBTN_MODE_ENABLE_REGISTRY != 0
+    simpleButton_Type_RegistryNode_t Registry;
+#endif /* SIMPLEBTN_MODE_ENABLE_REGISTRY != 0 */
+
 } simpleButton_Type_Button_t;
 
 /**
@@ -271,9 +518,26 @@ typedef struct SimpleButton_Type_DynamicBtn_t {
     simpleButton_Type_PrivateBtnStatus_t Private;
 
     simpleButton_Type_PublicBtnStatus_t Public;
+
+#if SIMPLEBTN_MODE_ENABLE_ADAPTIVE_POLLING != 0
+    uint32_t                        nextPollTick; /* an idle button is not polled before it */
+#endif /* SIMPLEBTN_MODE_ENABLE_ADAPTIVE_POLLING != 0 */
+
+#if SIMPLEBTN_MODE_ENABLE_REGISTRY != 0
+    simpleButton_Type_RegistryNode_t Registry;
+#endif /* SIMPLEBTN_MODE_ENABLE_REGISTRY != 0 */
     
 } SimpleButton_Type_DynamicBtn_t;
 
+/* A button without a pin of its own, fed by a scan engine (key-matrix, ADC ladder, input source...) */
+typedef struct simpleButton_Type_VirtualKey_t {
+
+    simpleButton_Type_PrivateBtnStatus_t Private;
+
+    simpleButton_Type_PublicBtnStatus_t Public;
+
+} simpleButton_Type_VirtualKey_t;
+
 /* Init the Button.Public */
 SIMPLEBTN_C_API void simpleButton_Private_InitStructPublic(
     simpleButton_Type_PublicBtnStatus_t* self_public
@@ -353,6 +617,29 @@ simpleButton_Private_AsynchronousHandler(
 );
 
 
+SIMPLEBTN_C_API void
+simpleButton_Private_PolledHandler(
+    simpleButton_Type_PrivateBtnStatus_t* const self_private,
+    simpleButton_Type_PublicBtnStatus_t* const self_public,
+    const uint8_t is_pushed,
+    simpleButton_Type_ShortPushCallBack_t shortPushCB,
+    simpleButton_Type_LongPushCallBack_t longPushCB,
+    simpleButton_Type_RepeatPushCallBack_t repeatPushCB,
+    volatile uint16_t* const currentKey
+);
+
+
+SIMPLEBTN_C_API uint32_t
+simpleButton_Private_ScanWord(
+    simpleButton_Type_VirtualKey_t* const keys,
+    const uint32_t pushed,
+    uint32_t active,
+    const simpleButton_Type_CallBackSet_t* const callBacks,
+    volatile uint16_t* const currentKey,
+    const uint16_t firstKey
+);
+
+
 #if (defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)) \
     || (defined(__cplusplus) && __cplusplus >= 201103L)
 
@@ -444,6 +731,17 @@ SIMPLEBTN_FORCE_INLINE uint32_t simpleButton_Private_IsIdle(const simpleButton_T
 #endif /* >= C99 or C++11 */
 
 
+/* Put the `_Init` function of the button into the registry section */
+#if defined(SIMPLEBTN_REGISTRY_SECTION)
+ #define SIMPLEBTN_REGISTRY_ENTRY(__name)                                       \
+    static void (* const                                                        \
+    SIMPLEBTN_CONNECT2(simpleButton_Private_InitEntry_, __name))(void)          \
+    __attribute__((used, section("simplebtn_init")))                            \
+        = &(SIMPLEBTN_CONNECT3(SIMPLEBTN_NAMESPACE, __name, _Init));
+#else
+ #define SIMPLEBTN_REGISTRY_ENTRY(__name)
+#endif /* defined(SIMPLEBTN_REGISTRY_SECTION) */
+
 /**
  * @def         SIMPLEBTN__CREATE
  * @brief       Creat a button.
@@ -496,7 +794,9 @@ SIMPLEBTN_FORCE_INLINE uint32_t simpleButton_Private_IsIdle(const simpleButton_T
             &(SIMPLEBTN_CONNECT2(simpleButton_Private_AsyHandler_, __name)),    \
             &(SIMPLEBTN_CONNECT2(simpleButton_Private_ITHandler_, __name))      \
         );                                                                      \
-    }
+    }                                                                           \
+                                                                                \
+    SIMPLEBTN_REGISTRY_ENTRY(__name)
 
 
 /**
@@ -533,6 +833,29 @@ SIMPLEBTN_FORCE_INLINE uint32_t simpleButton_Private_IsIdle(const simpleButton_T
 
 #endif /* SIMPLEBTN_MODE_ENABLE_COMBINATION != 0 */
 
+#if ( SIMPLEBTN_MODE_ENABLE_PRESS_RELEASE_EVENT != 0 )
+
+/**
+ * @def             SIMPLEBTN__EVTBTN_SETCALLBACK
+ * @brief           Set the pressed/released event callback functions of a button.
+ * 
+ * @param[inout]    button - The button (static or dynamic).
+ * @param[in]       pressedCB - Called as soon as the push is debounced. (can be 0)
+ * @param[in]       releasedCB - Called as soon as the release is debounced. (can be 0)
+ * 
+ * @note            These events are delivered in addition to the short/long/repeat
+ *                  events, and do not wait for the repeat-push window.
+ * 
+ * @attention       Make sure the macro `SIMPLEBTN_MODE_ENABLE_PRESS_RELEASE_EVENT` is defined as 1.
+ */
+ #define SIMPLEBTN__EVTBTN_SETCALLBACK(button, pressedCB, releasedCB)                    \
+    do {                                                                                \
+        (button).Public.eventConfig.pressedCallBack = pressedCB;                        \
+        (button).Public.eventConfig.releasedCallBack = releasedCB;                      \
+    } while(0)
+
+#endif /* SIMPLEBTN_MODE_ENABLE_PRESS_RELEASE_EVENT != 0 */
+
 SIMPLEBTN_C_API void
 SimpleButton_DynamicButton_Init(
     SimpleButton_Type_DynamicBtn_t* const self,
@@ -549,4 +872,142 @@ SimpleButton_DynamicButton_Handler(
     simpleButton_Type_RepeatPushCallBack_t repeatPushCallBack
 );
 
+#if SIMPLEBTN_MODE_ENABLE_ADAPTIVE_POLLING != 0
+
+/* Returned by `SimpleButton_xxx_NextPoll()` when nothing has to be polled */
+ #define SIMPLEBTN_NEXT_POLL_NEVER          0xFFFFFFFFUL
+
+SIMPLEBTN_C_API uint32_t
+SimpleButton_DynamicButton_NextPoll(
+    const SimpleButton_Type_DynamicBtn_t* const self
+);
+
+#endif /* SIMPLEBTN_MODE_ENABLE_ADAPTIVE_POLLING != 0 */
+
+#if SIMPLEBTN_MODE_ENABLE_REGISTRY != 0
+
+/**
+ * @def             SIMPLEBTN__REGISTRY_SETCALLBACK
+ * @brief           Set the callback functions used by `SimpleButton_Registry_HandleAll()`.
+ * 
+ * @param[inout]    button - The button (static or dynamic). It must be initialized first.
+ * @param[in]       shortCB - callback function for short push.
+ * @param[in]       longCB - callback function for long push.
+ * @param[in]       repeatCB - callback function for repeat push.
+ * 
+ * @attention       Make sure the macro `SIMPLEBTN_MODE_ENABLE_REGISTRY` is defined as 1.
+ */
+ #define SIMPLEBTN__REGISTRY_SETCALLBACK(button, shortCB, longCB, repeatCB)             \
+    do {                                                                                \
+        (button).Registry.callBacks.shortPushCallBack = shortCB;                        \
+        (button).Registry.callBacks.longPushCallBack = longCB;                          \
+        (button).Registry.callBacks.repeatPushCallBack = repeatCB;                      \
+    } while(0)
+
+/**
+ * @brief   Start low power if all of the registered buttons are idle.
+ * @return  None
+ */
+ #define SIMPLEBTN__START_LOWPOWER_ALL()                    \
+    do {                                                    \
+        SIMPLEBTN_FUNC_CRITICAL_SECTION_BEGIN();            \
+        if (SimpleButton_Registry_AllIdle()) {              \
+            SIMPLEBTN_FUNC_START_LOW_POWER();               \
+        }                                                   \
+        SIMPLEBTN_FUNC_CRITICAL_SECTION_END();              \
+    } while (0)
+
+SIMPLEBTN_C_API void
+SimpleButton_DynamicButton_Deinit(
+    SimpleButton_Type_DynamicBtn_t* const self
+);
+
+SIMPLEBTN_C_API void
+SimpleButton_Registry_HandleAll(void);
+
+SIMPLEBTN_C_API uint32_t
+SimpleButton_Registry_AllIdle(void);
+
+SIMPLEBTN_C_API uint32_t
+SimpleButton_Registry_HandleBudget(
+    uint32_t budgetUs
+);
+
+SIMPLEBTN_C_API const SimpleButton_Type_BudgetStats_t*
+SimpleButton_Registry_BudgetStats(void);
+
+SIMPLEBTN_C_API void
+SimpleButton_Registry_ResetBudgetStats(void);
+
+ #if SIMPLEBTN_MODE_ENABLE_ADAPTIVE_POLLING != 0
+
+SIMPLEBTN_C_API uint32_t
+SimpleButton_Registry_NextPoll(void);
+
+ #endif /* SIMPLEBTN_MODE_ENABLE_ADAPTIVE_POLLING != 0 */
+
+ #if SIMPLEBTN_MODE_ENABLE_TIMER_DRIVEN != 0
+
+SIMPLEBTN_C_API void
+SimpleButton_TimerDriven_Handler(void);
+
+SIMPLEBTN_C_API uint32_t
+SimpleButton_TimerDriven_IsRunning(void);
+
+ #endif /* SIMPLEBTN_MODE_ENABLE_TIMER_DRIVEN != 0 */
+
+ #if defined(SIMPLEBTN_REGISTRY_SECTION)
+
+SIMPLEBTN_C_API void
+SimpleButton_Registry_InitAll(void);
+
+ #endif /* defined(SIMPLEBTN_REGISTRY_SECTION) */
+
+#endif /* SIMPLEBTN_MODE_ENABLE_REGISTRY != 0 */
+
+#if SIMPLEBTN_MODE_ENABLE_DEFERRED_CALLBACK != 0
+
+SIMPLEBTN_C_API uint32_t
+SimpleButton_Deferred_Drain(void);
+
+SIMPLEBTN_C_API uint16_t
+SimpleButton_Deferred_CurrentKey(void);
+
+SIMPLEBTN_C_API uint32_t
+SimpleButton_Deferred_DropCount(void);
+
+#endif /* SIMPLEBTN_MODE_ENABLE_DEFERRED_CALLBACK != 0 */
+
+#if SIMPLEBTN_MODE_ENABLE_SNAPSHOT != 0
+
+/**
+ * @def         SIMPLEBTN__SNAPSHOT
+ * @brief       Read the snapshot of any button (static, dynamic, or a key of a scan engine).
+ * @param[in]   button - The button object (not its pointer).
+ * @param[out]  snapshot - The pointer of a `SimpleButton_Type_BtnSnapshot_t`.
+ */
+ #define SIMPLEBTN__SNAPSHOT(button, snapshot)              \
+    SimpleButton_Snapshot_Read(&((button).Private), snapshot)
+
+SIMPLEBTN_C_API uint32_t
+SimpleButton_Snapshot_Read(
+    const simpleButton_Type_PrivateBtnStatus_t* const self_private,
+    SimpleButton_Type_BtnSnapshot_t* const snapshot
+);
+
+/**
+ * @brief   How long the button of a snapshot has been held.
+ * @param   now - The current tick.
+ * @return  The hold time, or 0 if it is not held.
+ */
+SIMPLEBTN_FORCE_INLINE uint32_t
+SimpleButton_Snapshot_HoldTime(
+    const SimpleButton_Type_BtnSnapshot_t* const snapshot,
+    const uint32_t now
+) {
+    return snapshot->is_held ? (now - snapshot->pushTick) : 0U;
+}
+
+#endif /* SIMPLEBTN_MODE_ENABLE_SNAPSHOT != 0 */
+
 #endif /* SIMPLEBUTTON_H__ */
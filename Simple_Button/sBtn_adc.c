@@ -0,0 +1,195 @@
+/**
+ * @file            sBtn_adc.c
+ *
+ * @author          Kim-J-Smith
+ *
+ * @brief           Source file of the resistor-ladder ADC buttons. This file
+ *                  contains functions for ladder-init, voltage classification
+ *                  with hysteresis, and feeding the keys into the button
+ *                  state machine.
+ *
+ * @version         0.8.x
+ *
+ * @date            2025-10-03
+ *
+ * @attention       Copyright (c) 2025 Kim-J-Smith.
+ *                  All rights reserved.
+ *
+ * @copyright       SPDX-License-Identifier: MIT
+ *                  Refer to the LICENCE file in root for more details.
+ *                  <https://github.com/Kim-J-Smith/Simple-Button>
+ */
+#include    "sBtn_adc.h"
+
+
+/* HOT : Trigger hotspot optimization */
+#if defined(__GNUC__) || defined(__clang__)
+ #define HOT_ __attribute__((hot))
+#elif defined(_MSC_VER) && ( _MSC_VER >= 1900 )
+ #define HOT_ __declspec(hot)
+#else
+ #define HOT_
+#endif /* HOT */
+
+/* a helper function : the lower bound of a ladder position */
+SIMPLEBTN_FORCE_INLINE uint32_t
+simpleButton_Private_Adc_Lower(
+    const SimpleButton_Type_AdcLadder_t* const self,
+    const uint8_t position
+) {
+    return (position == 0) ? 0U : (uint32_t)self->config.thresholds[position - 1];
+}
+
+/* a helper function : the upper bound (exclusive) of a ladder position */
+SIMPLEBTN_FORCE_INLINE uint32_t
+simpleButton_Private_Adc_Upper(
+    const SimpleButton_Type_AdcLadder_t* const self,
+    const uint8_t position
+) {
+    return (position == self->keyCount) ? 0x10000U : (uint32_t)self->config.thresholds[position];
+}
+
+/**
+ * @brief           Classify one ADC sample into a ladder position.
+ *
+ * @return          The pushed key, or `keyCount` for none.
+ *
+ * @note            The current position is widened by `hysteresis` on both
+ *                  sides, so a voltage near a threshold does not toggle
+ *                  between two positions.
+ */
+SIMPLEBTN_FORCE_INLINE uint8_t
+simpleButton_Private_Adc_Classify(
+    const SimpleButton_Type_AdcLadder_t* const self,
+    const uint16_t value
+) {
+    const uint32_t hysteresis = self->config.hysteresis;
+    uint8_t position = self->position;
+
+    if ((uint32_t)value + hysteresis >= simpleButton_Private_Adc_Lower(self, position)
+        && (uint32_t)value < simpleButton_Private_Adc_Upper(self, position) + hysteresis
+    ) {
+        return position; /* still in the current position */
+    }
+
+    for (position = 0; position < self->keyCount; position++) {
+        if (value < self->config.thresholds[position]) {
+            break;
+        }
+    }
+
+    return position;
+}
+
+/**
+ * @brief           Initialize the resistor-ladder.
+ *
+ * @param[inout]    self - The pointer of the ladder.
+ * @param[in]       keys - Storage of `keyCount` keys.
+ * @param[in]       keyCount - The number of keys. (1 ~ 16)
+ * @param[in]       config - The ADC hook and the thresholds. (copied, but
+ *                  `thresholds` must stay valid)
+ *
+ * @return          None
+ */
+SIMPLEBTN_C_API void
+SimpleButton_AdcLadder_Init(
+    SimpleButton_Type_AdcLadder_t* const self,
+    simpleButton_Type_VirtualKey_t* const keys,
+    uint8_t keyCount,
+    const SimpleButton_Type_AdcLadderConfig_t* const config
+) {
+    uint8_t i;
+
+#if defined(SIMPLEBTN_DEBUG)
+    if (0 == self || 0 == keys || 0 == config || 0 == config->readAdc || 0 == config->thresholds
+        || keyCount == 0 || keyCount > SIMPLEBTN_ADC_MAX_KEYS
+    ) {
+        SIMPLEBTN_FUNC_PANIC(
+            "invalid input in func:SimpleButton_AdcLadder_Init",
+            simpleButton_ErrorNum_invalidInput,
+        );
+    }
+#endif /* defined(SIMPLEBTN_DEBUG) */
+
+    SIMPLEBTN_FUNC_CRITICAL_SECTION_BEGIN(); /* critical section begin */
+
+    self->keys = keys;
+    self->config = *config;
+    self->callBacks.shortPushCallBack = 0;
+    self->callBacks.longPushCallBack = 0;
+    self->callBacks.repeatPushCallBack = 0;
+    self->lastValue = 0;
+    self->keyActive = 0;
+    self->keyCount = keyCount;
+    self->position = keyCount;
+    self->currentKey = 0;
+
+    for (i = 0; i < keyCount; i++) {
+        simpleButton_Private_InitStructPrivate(&(keys[i].Private));
+        simpleButton_Private_InitStructPublic(&(keys[i].Public));
+    }
+
+    SIMPLEBTN_FUNC_CRITICAL_SECTION_END(); /* critical section end */
+}
+
+/**
+ * @brief           Sample the ADC once and handle the keys of the ladder.
+ *
+ * @param[inout]    self - The pointer of the ladder.
+ *
+ * @return          None
+ *
+ * @note            Only the pushed key and the keys which are not idle are
+ *                  handled. A ladder can only report one key at a time; the
+ *                  voltage passing other positions while a key moves is
+ *                  filtered by the push debounce of the state machine.
+ */
+SIMPLEBTN_C_API HOT_ void
+SimpleButton_AdcLadder_Handler(
+    SimpleButton_Type_AdcLadder_t* const self
+) {
+    const uint16_t value = self->config.readAdc();
+
+    self->lastValue = value;
+    self->position = simpleButton_Private_Adc_Classify(self, value);
+
+    self->keyActive = simpleButton_Private_ScanWord(
+        self->keys,
+        (self->position < self->keyCount) ? (1UL << self->position) : 0U,
+        self->keyActive,
+        &(self->callBacks),
+        &(self->currentKey),
+        0
+    );
+}
+
+/**
+ * @brief           Get the `Public` config of a key, to change its adjustable time,
+ *                  pressed/released events, ...
+ *
+ * @return          The pointer of `Public`, or 0 if the key does not exist.
+ */
+SIMPLEBTN_C_API simpleButton_Type_PublicBtnStatus_t*
+SimpleButton_AdcLadder_GetKeyPublic(
+    SimpleButton_Type_AdcLadder_t* const self,
+    uint8_t key
+) {
+    if (key >= self->keyCount) {
+        return 0;
+    }
+
+    return &(self->keys[key].Public);
+}
+
+/**
+ * @brief           Check whether all the keys of the ladder are idle.
+ *
+ * @return          Non-zero if all of them are in `Wait_For_Interrupt` state.
+ */
+SIMPLEBTN_C_API uint32_t
+SimpleButton_AdcLadder_AllIdle(
+    SimpleButton_Type_AdcLadder_t* const self
+) {
+    return (self->keyActive == 0 && self->position >= self->keyCount);
+}
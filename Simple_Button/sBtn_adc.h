@@ -0,0 +1,174 @@
+/**
+ * @file            sBtn_adc.h
+ *
+ * @author          Kim-J-Smith
+ *
+ * @brief           Header file of the resistor-ladder ADC buttons. Several
+ *                  keys share one ADC pin through a resistor ladder. The ADC
+ *                  is sampled once per scan, the voltage is classified into
+ *                  a ladder position, and every position drives a virtual
+ *                  button through the button state machine.
+ *
+ * @version         0.8.x
+ *
+ * @date            2025-10-03
+ *
+ * @attention       Copyright (c) 2025 Kim-J-Smith.
+ *                  All rights reserved.
+ *
+ * @copyright       SPDX-License-Identifier: MIT
+ *                  Refer to the LICENCE file in root for more details.
+ *                  <https://github.com/Kim-J-Smith/Simple-Button>
+ */
+#ifndef     SIMPLEBUTTON_ADC_H__
+#define     SIMPLEBUTTON_ADC_H__        1020L
+
+#include    "Simple_Button.h"
+#if ( SIMPLEBUTTON_ADC_H__ != SIMPLEBUTTON_H__ )
+ #warning [Simple-Button] : the version of "sBtn_adc.h"\
+ is different from it of "Simple_Button.h".
+#endif /* SIMPLEBUTTON_ADC_H__ != SIMPLEBUTTON_H__ */
+
+/* The max number of keys on one ladder */
+#define SIMPLEBTN_ADC_MAX_KEYS                  16U
+
+/* Read one (converted) sample of the ladder's ADC channel. */
+typedef uint16_t (* SimpleButton_Type_AdcRead_t)(void);
+
+/**
+ * @struct      SimpleButton_Type_AdcLadderConfig_t
+ *
+ * @brief       The ADC hook and the thresholds of a resistor ladder.
+ *
+ * @note        `thresholds` has `keyCount` values in ascending order.
+ *              Key N is pushed when `thresholds[N-1] <= value < thresholds[N]`
+ *              (key 0 from 0), and no key is pushed when the value is
+ *              above `thresholds[keyCount-1]`. Put each threshold halfway
+ *              between two neighbouring ladder voltages.
+ */
+typedef struct SimpleButton_Type_AdcLadderConfig_t {
+
+    SimpleButton_Type_AdcRead_t     readAdc;
+
+    const uint16_t*                 thresholds;
+
+    uint16_t                        hysteresis; /* the current position is kept within this margin */
+
+} SimpleButton_Type_AdcLadderConfig_t;
+
+/**
+ * @struct      SimpleButton_Type_AdcLadder_t
+ *
+ * @brief       The resistor-ladder object.
+ */
+typedef struct SimpleButton_Type_AdcLadder_t {
+
+    simpleButton_Type_VirtualKey_t* keys;
+
+    SimpleButton_Type_AdcLadderConfig_t config;
+
+    simpleButton_Type_CallBackSet_t callBacks;
+
+    uint16_t                        lastValue; /* the last ADC sample */
+
+    uint32_t                        keyActive; /* keys which are not idle */
+
+    volatile uint16_t               currentKey; /* the key whose callback is running */
+
+    uint8_t                         keyCount;
+
+    uint8_t                         position; /* the pushed key, or `keyCount` for none */
+
+} SimpleButton_Type_AdcLadder_t;
+
+/**
+ * @def         SIMPLEBTN__ADCLADDER_CREATE
+ * @brief       Create a resistor-ladder with static storage.
+ * @param[in]   __keys - The number of keys. (1 ~ 16)
+ * @param[in]   __name - The name of the ladder.
+ * @note        Initialize it with `prefix/namespace` + `__name` + `_Init(&config)`.
+ */
+#define SIMPLEBTN__ADCLADDER_CREATE(__keys, __name)                             \
+    static simpleButton_Type_VirtualKey_t                                       \
+    SIMPLEBTN_CONNECT2(simpleButton_Private_AdcKeys_, __name)[__keys];          \
+                                                                                \
+    SimpleButton_Type_AdcLadder_t                                               \
+    SIMPLEBTN_CONNECT2(SIMPLEBTN_NAMESPACE, __name);                            \
+                                                                                \
+    SIMPLEBTN_C_API void                                                        \
+    SIMPLEBTN_CONNECT3(SIMPLEBTN_NAMESPACE, __name, _Init)(                     \
+        const SimpleButton_Type_AdcLadderConfig_t* const config                 \
+    ) {                                                                         \
+        SimpleButton_AdcLadder_Init(                                            \
+            &(SIMPLEBTN_CONNECT2(SIMPLEBTN_NAMESPACE, __name)),                 \
+            SIMPLEBTN_CONNECT2(simpleButton_Private_AdcKeys_, __name),          \
+            (uint8_t)(__keys),                                                  \
+            config                                                              \
+        );                                                                      \
+    }
+
+/**
+ * @def         SIMPLEBTN__ADCLADDER_DECLARE
+ * @param[in]   __name - The name of ladder.
+ */
+#define SIMPLEBTN__ADCLADDER_DECLARE(__name)                                    \
+    extern SimpleButton_Type_AdcLadder_t                                        \
+    SIMPLEBTN_CONNECT2(SIMPLEBTN_NAMESPACE, __name);                            \
+    SIMPLEBTN_C_API void                                                        \
+    SIMPLEBTN_CONNECT3(SIMPLEBTN_NAMESPACE, __name, _Init)(                     \
+        const SimpleButton_Type_AdcLadderConfig_t* const config                 \
+    );
+
+/**
+ * @def             SIMPLEBTN__ADCLADDER_SETCALLBACK
+ * @brief           Set the callback functions shared by all the keys of a ladder.
+ *                  Use `SimpleButton_AdcLadder_CurrentKey()` in them to get the key.
+ */
+#define SIMPLEBTN__ADCLADDER_SETCALLBACK(ladder, shortCB, longCB, repeatCB)             \
+    do {                                                                                \
+        (ladder).callBacks.shortPushCallBack = shortCB;                                 \
+        (ladder).callBacks.longPushCallBack = longCB;                                   \
+        (ladder).callBacks.repeatPushCallBack = repeatCB;                               \
+    } while(0)
+
+SIMPLEBTN_C_API void
+SimpleButton_AdcLadder_Init(
+    SimpleButton_Type_AdcLadder_t* const self,
+    simpleButton_Type_VirtualKey_t* const keys,
+    uint8_t keyCount,
+    const SimpleButton_Type_AdcLadderConfig_t* const config
+);
+
+SIMPLEBTN_C_API void
+SimpleButton_AdcLadder_Handler(
+    SimpleButton_Type_AdcLadder_t* const self
+);
+
+SIMPLEBTN_C_API simpleButton_Type_PublicBtnStatus_t*
+SimpleButton_AdcLadder_GetKeyPublic(
+    SimpleButton_Type_AdcLadder_t* const self,
+    uint8_t key
+);
+
+SIMPLEBTN_C_API uint32_t
+SimpleButton_AdcLadder_AllIdle(
+    SimpleButton_Type_AdcLadder_t* const self
+);
+
+/**
+ * @brief   Get the key whose callback function is running.
+ * @return  The ladder position of the key.
+ */
+SIMPLEBTN_FORCE_INLINE uint16_t
+SimpleButton_AdcLadder_CurrentKey(
+    const SimpleButton_Type_AdcLadder_t* const self
+) {
+#if SIMPLEBTN_MODE_ENABLE_DEFERRED_CALLBACK != 0
+    (void)self;
+    return SimpleButton_Deferred_CurrentKey(); /* the scanner may be on another key */
+#else
+    return self->currentKey;
+#endif /* SIMPLEBTN_MODE_ENABLE_DEFERRED_CALLBACK != 0 */
+}
+
+#endif /* SIMPLEBUTTON_ADC_H__ */
@@ -0,0 +1,325 @@
+/**
+ * @file            sBtn_chord.c
+ *
+ * @author          Kim-J-Smith
+ *
+ * @brief           Source file of the chord matcher. This file contains the
+ *                  chord table compiler (mask hash) and the matcher driven by
+ *                  the changes of the held keys.
+ *
+ * @version         0.8.x
+ *
+ * @date            2025-10-03
+ *
+ * @attention       Copyright (c) 2025 Kim-J-Smith.
+ *                  All rights reserved.
+ *
+ * @copyright       SPDX-License-Identifier: MIT
+ *                  Refer to the LICENCE file in root for more details.
+ *                  <https://github.com/Kim-J-Smith/Simple-Button>
+ */
+#include    "sBtn_chord.h"
+
+
+/* HOT : Trigger hotspot optimization */
+#if defined(__GNUC__) || defined(__clang__)
+ #define HOT_ __attribute__((hot))
+#elif defined(_MSC_VER) && ( _MSC_VER >= 1900 )
+ #define HOT_ __declspec(hot)
+#else
+ #define HOT_
+#endif /* HOT */
+
+/* a helper function : the first slot of a mask in the hash table */
+SIMPLEBTN_FORCE_INLINE uint8_t
+simpleButton_Private_Chord_Hash(const uint32_t mask, const uint8_t hashSize)
+{
+    return (uint8_t)(((mask * 0x9E3779B1UL) >> 16) % hashSize);
+}
+
+/* a helper function : the index of the lowest set bit (x != 0) */
+SIMPLEBTN_FORCE_INLINE uint8_t
+simpleButton_Private_Chord_LowestBit(uint32_t x)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return (uint8_t)__builtin_ctz(x);
+#else
+    uint8_t n = 0;
+    while ((x & 1U) == 0) {
+        x >>= 1;
+        n ++;
+    }
+    return n;
+#endif /* defined(__GNUC__) || defined(__clang__) */
+}
+
+/* a helper function : find the chord of the held keys, in the order they were pushed */
+static uint8_t
+simpleButton_Private_Chord_Find(
+    const SimpleButton_Type_ChordSet_t* const self,
+    const uint32_t mask
+) {
+    uint8_t slot = simpleButton_Private_Chord_Hash(mask, self->hashSize);
+    uint8_t chord;
+
+    /* 1. find the first chord with this mask */
+    for (;;) {
+        if (self->hashTable[slot] == 0) {
+            return SIMPLEBTN_CHORD_NONE;
+        }
+        if (self->chords[self->hashTable[slot] - 1U].mask == mask) {
+            break;
+        }
+        slot = (uint8_t)((slot + 1U) % self->hashSize);
+    }
+
+    /* 2. take the first one whose order fits */
+    for (chord = (uint8_t)(self->hashTable[slot] - 1U); chord != SIMPLEBTN_CHORD_NONE; chord = self->sameNext[chord]) {
+        const uint8_t* const order = self->chords[chord].order;
+        uint8_t i;
+
+        if (order == 0) {
+            return chord;
+        }
+        for (i = 0; i < self->orderLength && order[i] == self->order[i]; i++) {}
+        if (i == self->orderLength) {
+            return chord;
+        }
+    }
+
+    return SIMPLEBTN_CHORD_NONE;
+}
+
+/* a helper function : report a chord and wait for all the keys released */
+SIMPLEBTN_FORCE_INLINE void
+simpleButton_Private_Chord_Fire(
+    SimpleButton_Type_ChordSet_t* const self,
+    const uint8_t chord
+) {
+    self->is_done = 1;
+    self->pending = SIMPLEBTN_CHORD_NONE;
+
+    if (self->callBack != 0) {
+        self->callBack(chord);
+    }
+}
+
+/**
+ * @brief           Initialize the chord matcher and hash the chord table.
+ *
+ * @param[inout]    self - The pointer of the matcher.
+ * @param[in]       tableBuffer - Storage of `4 * maxChords` bytes.
+ * @param[in]       maxChords - The max number of chords. (1 ~ 127)
+ * @param[in]       chords - The chord table. (kept, not copied)
+ * @param[in]       chordCount - The number of chords. (1 ~ maxChords)
+ *
+ * @return          None
+ *
+ * @note            The chords with 2 or more keys only. Several chords may
+ *                  share a mask with different orders; the first one listed
+ *                  wins when more than one fits.
+ */
+SIMPLEBTN_C_API void
+SimpleButton_Chord_Init(
+    SimpleButton_Type_ChordSet_t* const self,
+    uint8_t* const tableBuffer,
+    uint8_t maxChords,
+    const SimpleButton_Type_ChordPattern_t* const chords,
+    uint8_t chordCount
+) {
+    uint8_t i;
+    uint8_t j;
+
+#if defined(SIMPLEBTN_DEBUG)
+    if (0 == self || 0 == tableBuffer || 0 == chords || maxChords == 0 || maxChords > 127
+        || chordCount == 0 || chordCount > maxChords
+    ) {
+        SIMPLEBTN_FUNC_PANIC(
+            "invalid input in func:SimpleButton_Chord_Init",
+            simpleButton_ErrorNum_invalidInput,
+        );
+    }
+#endif /* defined(SIMPLEBTN_DEBUG) */
+
+    SIMPLEBTN_FUNC_CRITICAL_SECTION_BEGIN(); /* critical section begin */
+
+    self->chords = chords;
+    self->hashSize = (uint8_t)(2U * maxChords);
+    self->hashTable = tableBuffer;
+    self->sameNext = tableBuffer + self->hashSize;
+    self->hasSuperset = self->sameNext + maxChords;
+    self->callBack = 0;
+    self->held = 0;
+    self->timeStamp_first = 0;
+    self->window = SIMPLEBTN_TIME_CHORD_WINDOW;
+    self->orderLength = 0;
+    self->pending = SIMPLEBTN_CHORD_NONE;
+    self->is_done = 0;
+    self->chordCount = chordCount;
+
+    for (i = 0; i < self->hashSize; i++) {
+        self->hashTable[i] = 0;
+    }
+
+    for (i = 0; i < chordCount; i++) {
+        uint8_t slot = simpleButton_Private_Chord_Hash(chords[i].mask, self->hashSize);
+
+        self->sameNext[i] = SIMPLEBTN_CHORD_NONE;
+        self->hasSuperset[i] = 0;
+
+        /* a longer chord containing this one makes the match wait for the window */
+        for (j = 0; j < chordCount; j++) {
+            if (chords[j].mask != chords[i].mask && (chords[j].mask & chords[i].mask) == chords[i].mask) {
+                self->hasSuperset[i] = 1;
+            }
+        }
+
+        /* open addressing, the chords of the same mask are chained */
+        while (self->hashTable[slot] != 0 && chords[self->hashTable[slot] - 1U].mask != chords[i].mask) {
+            slot = (uint8_t)((slot + 1U) % self->hashSize);
+        }
+
+        if (self->hashTable[slot] == 0) {
+            self->hashTable[slot] = (uint8_t)(i + 1U);
+        } else {
+            for (j = (uint8_t)(self->hashTable[slot] - 1U); self->sameNext[j] != SIMPLEBTN_CHORD_NONE; j = self->sameNext[j]) {}
+            self->sameNext[j] = i;
+        }
+    }
+
+    SIMPLEBTN_FUNC_CRITICAL_SECTION_END(); /* critical section end */
+}
+
+/**
+ * @brief           Give the matcher the keys held now.
+ *
+ * @param[inout]    self - The pointer of the matcher.
+ * @param[in]       held - Bit N is set while key N is held, e.g. `scanner.pushed[0]`.
+ *
+ * @return          None
+ *
+ * @note            Nothing is done if the mask did not change, so it can be
+ *                  called every scan. A change costs one hash lookup, whatever
+ *                  the number of chords.
+ *
+ *                  A chord is recognized when exactly its keys are held and
+ *                  the last one came within `window` of the first. If a longer
+ *                  chord contains it, it is reported at the end of the window
+ *                  (see `SimpleButton_Chord_Handler()`) or at the first release.
+ *                  After a match, a late key or a release, nothing more is
+ *                  reported until all the keys are released.
+ */
+SIMPLEBTN_C_API HOT_ void
+SimpleButton_Chord_Update(
+    SimpleButton_Type_ChordSet_t* const self,
+    uint32_t held
+) {
+    const uint32_t previous = self->held;
+    uint32_t pressed = held & ~previous;
+    uint32_t now;
+    uint8_t chord;
+
+    if (held == previous) {
+        return;
+    }
+    self->held = held;
+    now = SIMPLEBTN_FUNC_GET_TICK();
+
+    /* 1. a key was released : the attempt is over */
+    if ((previous & ~held) != 0) {
+        if (self->pending != SIMPLEBTN_CHORD_NONE) {
+            simpleButton_Private_Chord_Fire(self, self->pending);
+        }
+        self->is_done = 1;
+        if (held == 0) {
+            self->is_done = 0; /* all released, start again */
+            self->orderLength = 0;
+        }
+        return;
+    }
+
+    /* 2. a new attempt begins with the first key */
+    if (previous == 0) {
+        self->timeStamp_first = now;
+        self->orderLength = 0;
+        self->is_done = 0;
+        self->pending = SIMPLEBTN_CHORD_NONE;
+    }
+
+    while (pressed != 0) {
+        if (self->orderLength < SIMPLEBTN_CHORD_MAX_KEYS) {
+            self->order[self->orderLength ++] = simpleButton_Private_Chord_LowestBit(pressed);
+        }
+        pressed &= pressed - 1U;
+    }
+
+    if (self->is_done) {
+        return;
+    }
+
+    /* 3. a key after the window breaks the attempt (a waiting chord is reported) */
+    if ((uint32_t)(now - self->timeStamp_first) > self->window) {
+        if (self->pending != SIMPLEBTN_CHORD_NONE) {
+            simpleButton_Private_Chord_Fire(self, self->pending);
+        }
+        self->is_done = 1;
+        return;
+    }
+
+    /* 4. look up the held keys */
+    chord = simpleButton_Private_Chord_Find(self, held);
+    self->pending = SIMPLEBTN_CHORD_NONE;
+
+    if (chord == SIMPLEBTN_CHORD_NONE) {
+        return; /* maybe a part of a longer chord */
+    }
+
+    if (self->hasSuperset[chord]) {
+        self->pending = chord;
+    } else {
+        simpleButton_Private_Chord_Fire(self, chord);
+    }
+}
+
+/**
+ * @brief           Give the matcher one push/release of a key.
+ *
+ * @param[inout]    self - The pointer of the matcher.
+ * @param[in]       key - The key. (0 ~ 31)
+ * @param[in]       is_pushed - Non-zero for a push, 0 for a release.
+ *
+ * @return          None
+ *
+ * @note            For the keys without a bitmap, e.g. from the pressed/released
+ *                  event callbacks of the buttons.
+ */
+SIMPLEBTN_C_API void
+SimpleButton_Chord_KeyEvent(
+    SimpleButton_Type_ChordSet_t* const self,
+    uint8_t key,
+    uint8_t is_pushed
+) {
+    SimpleButton_Chord_Update(self,
+        is_pushed ? (self->held | SIMPLEBTN_CHORD_KEY(key)) : (self->held & ~SIMPLEBTN_CHORD_KEY(key)));
+}
+
+/**
+ * @brief           Report the waiting chord when the window is over.
+ *
+ * @param[inout]    self - The pointer of the matcher.
+ *
+ * @return          None
+ *
+ * @note            Call it in the while loop, only needed when some chords are
+ *                  contained in longer ones.
+ */
+SIMPLEBTN_C_API void
+SimpleButton_Chord_Handler(
+    SimpleButton_Type_ChordSet_t* const self
+) {
+    if (self->pending != SIMPLEBTN_CHORD_NONE
+        && (uint32_t)(SIMPLEBTN_FUNC_GET_TICK() - self->timeStamp_first) > self->window
+    ) {
+        simpleButton_Private_Chord_Fire(self, self->pending);
+    }
+}
@@ -0,0 +1,167 @@
+/**
+ * @file            sBtn_chord.h
+ *
+ * @author          Kim-J-Smith
+ *
+ * @brief           Header file of the chord matcher. The set of held keys
+ *                  (a bitmask) is matched against a table of 2-to-N-key
+ *                  chords, in any order or in a given order, pressed within
+ *                  a simultaneity window.
+ *
+ * @version         0.8.x
+ *
+ * @date            2025-10-03
+ *
+ * @attention       Copyright (c) 2025 Kim-J-Smith.
+ *                  All rights reserved.
+ *
+ * @copyright       SPDX-License-Identifier: MIT
+ *                  Refer to the LICENCE file in root for more details.
+ *                  <https://github.com/Kim-J-Smith/Simple-Button>
+ */
+#ifndef     SIMPLEBUTTON_CHORD_H__
+#define     SIMPLEBUTTON_CHORD_H__      1020L
+
+#include    "Simple_Button.h"
+#if ( SIMPLEBUTTON_CHORD_H__ != SIMPLEBUTTON_H__ )
+ #warning [Simple-Button] : the version of "sBtn_chord.h"\
+ is different from it of "Simple_Button.h".
+#endif /* SIMPLEBUTTON_CHORD_H__ != SIMPLEBUTTON_H__ */
+
+/* The max number of keys of the chord matcher */
+#define SIMPLEBTN_CHORD_MAX_KEYS                32U
+
+/* The "no chord" index */
+#define SIMPLEBTN_CHORD_NONE                    0xFFU
+
+/* The bit of key `key` in the held mask. (key : 0 ~ 31) */
+#define SIMPLEBTN_CHORD_KEY(key)                (1UL << (key))
+
+/* The callback function when the chord `chord` is recognized. */
+typedef void (* SimpleButton_Type_ChordCallBack_t)(uint8_t chord);
+
+/**
+ * @struct      SimpleButton_Type_ChordPattern_t
+ *
+ * @brief       One chord.
+ *
+ * @note        `order` is 0 for a chord pressed in any order, or the keys
+ *              of `mask` in the order they must be pressed.
+ */
+typedef struct SimpleButton_Type_ChordPattern_t {
+
+    uint32_t            mask;
+
+    const uint8_t*      order;
+
+} SimpleButton_Type_ChordPattern_t;
+
+/**
+ * @struct      SimpleButton_Type_ChordSet_t
+ *
+ * @brief       The chord matcher object.
+ *
+ * @note        `hashTable` maps a mask to its first chord (index + 1, open
+ *              addressing), and `sameNext` links the chords sharing a mask.
+ */
+typedef struct SimpleButton_Type_ChordSet_t {
+
+    const SimpleButton_Type_ChordPattern_t* chords;
+
+    uint8_t*            hashTable;
+
+    uint8_t*            sameNext; /* next chord with the same mask, or SIMPLEBTN_CHORD_NONE */
+
+    uint8_t*            hasSuperset; /* a longer chord contains this one */
+
+    SimpleButton_Type_ChordCallBack_t callBack;
+
+    uint32_t            held;
+
+    uint32_t            timeStamp_first; /* the first key of this attempt */
+
+    uint32_t            window; /* max time from the first key to the last (ms) */
+
+    uint8_t             order[SIMPLEBTN_CHORD_MAX_KEYS];
+
+    uint8_t             orderLength;
+
+    uint8_t             pending; /* matched, waiting for a longer chord */
+
+    uint8_t             is_done; /* matched or broken, wait for all released */
+
+    uint8_t             chordCount;
+
+    uint8_t             hashSize;
+
+} SimpleButton_Type_ChordSet_t;
+
+/**
+ * @def         SIMPLEBTN__CHORD_CREATE
+ * @brief       Create a chord matcher with static storage.
+ * @param[in]   __maxChords - The max number of chords. (1 ~ 127)
+ * @param[in]   __name - The name of the matcher.
+ * @note        Initialize it with `prefix/namespace` + `__name` + `_Init(chords, count)`.
+ */
+#define SIMPLEBTN__CHORD_CREATE(__maxChords, __name)                            \
+    static uint8_t                                                              \
+    SIMPLEBTN_CONNECT2(simpleButton_Private_ChordTable_, __name)[4 * (__maxChords)]; \
+                                                                                \
+    SimpleButton_Type_ChordSet_t                                                \
+    SIMPLEBTN_CONNECT2(SIMPLEBTN_NAMESPACE, __name);                            \
+                                                                                \
+    SIMPLEBTN_C_API void                                                        \
+    SIMPLEBTN_CONNECT3(SIMPLEBTN_NAMESPACE, __name, _Init)(                     \
+        const SimpleButton_Type_ChordPattern_t* const chords,                   \
+        uint8_t chordCount                                                      \
+    ) {                                                                         \
+        SimpleButton_Chord_Init(                                                \
+            &(SIMPLEBTN_CONNECT2(SIMPLEBTN_NAMESPACE, __name)),                 \
+            SIMPLEBTN_CONNECT2(simpleButton_Private_ChordTable_, __name),       \
+            (uint8_t)(__maxChords),                                             \
+            chords,                                                             \
+            chordCount                                                          \
+        );                                                                      \
+    }
+
+/**
+ * @def         SIMPLEBTN__CHORD_DECLARE
+ * @param[in]   __name - The name of matcher.
+ */
+#define SIMPLEBTN__CHORD_DECLARE(__name)                                        \
+    extern SimpleButton_Type_ChordSet_t                                         \
+    SIMPLEBTN_CONNECT2(SIMPLEBTN_NAMESPACE, __name);                            \
+    SIMPLEBTN_C_API void                                                        \
+    SIMPLEBTN_CONNECT3(SIMPLEBTN_NAMESPACE, __name, _Init)(                     \
+        const SimpleButton_Type_ChordPattern_t* const chords,                   \
+        uint8_t chordCount                                                      \
+    );
+
+SIMPLEBTN_C_API void
+SimpleButton_Chord_Init(
+    SimpleButton_Type_ChordSet_t* const self,
+    uint8_t* const tableBuffer,
+    uint8_t maxChords,
+    const SimpleButton_Type_ChordPattern_t* const chords,
+    uint8_t chordCount
+);
+
+SIMPLEBTN_C_API void
+SimpleButton_Chord_Update(
+    SimpleButton_Type_ChordSet_t* const self,
+    uint32_t held
+);
+
+SIMPLEBTN_C_API void
+SimpleButton_Chord_KeyEvent(
+    SimpleButton_Type_ChordSet_t* const self,
+    uint8_t key,
+    uint8_t is_pushed
+);
+
+SIMPLEBTN_C_API void
+SimpleButton_Chord_Handler(
+    SimpleButton_Type_ChordSet_t* const self
+);
+
+#endif /* SIMPLEBUTTON_CHORD_H__ */
@@ -0,0 +1,289 @@
+/**
+ * @file            sBtn_dma.c
+ *
+ * @author          Kim-J-Smith
+ *
+ * @brief           Source file of the DMA scanning engine. This file contains
+ *                  functions for scanner-init, start/stop of the sampling,
+ *                  the transfer events, and the batch debouncing which feeds
+ *                  the keys into the button state machine.
+ *
+ * @version         0.8.x
+ *
+ * @date            2025-10-03
+ *
+ * @attention       Copyright (c) 2025 Kim-J-Smith.
+ *                  All rights reserved.
+ *
+ * @copyright       SPDX-License-Identifier: MIT
+ *                  Refer to the LICENCE file in root for more details.
+ *                  <https://github.com/Kim-J-Smith/Simple-Button>
+ */
+#include    "sBtn_dma.h"
+
+
+/* HOT : Trigger hotspot optimization */
+#if defined(__GNUC__) || defined(__clang__)
+ #define HOT_ __attribute__((hot))
+#elif defined(_MSC_VER) && ( _MSC_VER >= 1900 )
+ #define HOT_ __declspec(hot)
+#else
+ #define HOT_
+#endif /* HOT */
+
+/**
+ * @brief           Initialize the DMA scanner. The sampling is not started.
+ *
+ * @param[inout]    self - The pointer of the scanner.
+ * @param[in]       keys - Storage of `16 * portCount` keys.
+ * @param[in]       buffer - Storage of `portCount * depth` samples. (the DMA target)
+ * @param[in]       wordBuffer - Storage of `2 * portCount` words.
+ * @param[in]       portCount - The number of GPIO ports. (1 ~ 255)
+ * @param[in]       depth - The samples of each port. (even, 2 ~ 65534)
+ * @param[in]       config - The platform hooks and the ports. (copied)
+ *
+ * @return          None
+ */
+SIMPLEBTN_C_API void
+SimpleButton_DmaScan_Init(
+    SimpleButton_Type_DmaScanner_t* const self,
+    simpleButton_Type_VirtualKey_t* const keys,
+    volatile uint16_t* const buffer,
+    uint32_t* const wordBuffer,
+    uint8_t portCount,
+    uint16_t depth,
+    const SimpleButton_Type_DmaScanConfig_t* const config
+) {
+    uint32_t i;
+
+#if defined(SIMPLEBTN_DEBUG)
+    if (0 == self || 0 == keys || 0 == buffer || 0 == wordBuffer || 0 == config
+        || 0 == config->start || 0 == config->ports || portCount == 0
+        || depth < 2 || (depth & 1U) != 0
+    ) {
+        SIMPLEBTN_FUNC_PANIC(
+            "invalid input in func:SimpleButton_DmaScan_Init",
+            simpleButton_ErrorNum_invalidInput,
+        );
+    }
+#endif /* defined(SIMPLEBTN_DEBUG) */
+
+    SIMPLEBTN_FUNC_CRITICAL_SECTION_BEGIN(); /* critical section begin */
+
+    self->keys = keys;
+    self->buffer = buffer;
+    self->stable = wordBuffer;
+    self->active = wordBuffer + portCount;
+    self->config = *config;
+    self->callBacks.shortPushCallBack = 0;
+    self->callBacks.longPushCallBack = 0;
+    self->callBacks.repeatPushCallBack = 0;
+    self->batches = 0;
+    self->overruns = 0;
+    self->currentKey = 0;
+    self->depth = depth;
+    self->pending = 0;
+    self->nextHalf = 0;
+    self->portCount = portCount;
+
+    for (i = 0; i < portCount; i++) {
+        self->stable[i] = 0;
+        self->active[i] = 0;
+    }
+
+    for (i = 0; i < (uint32_t)portCount * SIMPLEBTN_DMA_PORT_PINS; i++) {
+        simpleButton_Private_InitStructPrivate(&(keys[i].Private));
+        simpleButton_Private_InitStructPublic(&(keys[i].Public));
+    }
+
+    SIMPLEBTN_FUNC_CRITICAL_SECTION_END(); /* critical section end */
+}
+
+/**
+ * @brief           Start the timer-triggered DMA sampling.
+ *
+ * @param[inout]    self - The pointer of the scanner.
+ *
+ * @return          None
+ */
+SIMPLEBTN_C_API void
+SimpleButton_DmaScan_Start(
+    SimpleButton_Type_DmaScanner_t* const self
+) {
+    SIMPLEBTN_FUNC_CRITICAL_SECTION_BEGIN(); /* critical section begin */
+
+    /* the transfer begins at the first half */
+    self->pending = 0;
+    self->nextHalf = 0;
+
+    SIMPLEBTN_FUNC_CRITICAL_SECTION_END(); /* critical section end */
+
+    self->config.start(self->config.context, self->config.ports,
+        self->portCount, self->buffer, self->depth);
+}
+
+/**
+ * @brief           Stop the timer-triggered DMA sampling.
+ *
+ * @param[inout]    self - The pointer of the scanner.
+ *
+ * @return          None
+ */
+SIMPLEBTN_C_API void
+SimpleButton_DmaScan_Stop(
+    SimpleButton_Type_DmaScanner_t* const self
+) {
+    if (self->config.stop != 0) {
+        self->config.stop(self->config.context);
+    }
+}
+
+/**
+ * @brief           Tell the scanner that a half of the buffer is filled.
+ *                  Call it in the half / full transfer ISR of the DMA of port 0.
+ *
+ * @param[inout]    self - The pointer of the scanner.
+ * @param[in]       is_full - 0 for the half transfer event, 1 for the full one.
+ *
+ * @return          None
+ */
+SIMPLEBTN_C_API void
+SimpleButton_DmaScan_TransferEvent(
+    SimpleButton_Type_DmaScanner_t* const self,
+    uint8_t is_full
+) {
+    const uint8_t half = (uint8_t)(is_full ? 2U : 1U);
+
+    if (self->pending & half) {
+        self->overruns ++; /* the handler has not taken the last batch of this half */
+    }
+    self->pending |= half;
+}
+
+/* a helper function : debounce one batch of a port, bit N is set if pin N is pushed */
+SIMPLEBTN_FORCE_INLINE uint32_t
+simpleButton_Private_Dma_Debounce(
+    const volatile uint16_t* const samples,
+    const uint16_t count,
+    const SimpleButton_Type_DmaPort_t* const port,
+    const uint32_t stable
+) {
+    uint16_t all = 0xFFFFU; /* pins high in every sample */
+    uint16_t any = 0;       /* pins high in some sample */
+    uint16_t pushedAll;
+    uint16_t pushedAny;
+    uint16_t i;
+
+    for (i = 0; i < count; i++) {
+        const uint16_t sample = samples[i];
+        all &= sample;
+        any |= sample;
+    }
+
+    /* a pin pushed at level 0 is pushed in every sample if it is never high */
+    pushedAll = (uint16_t)((all & ~port->pinInvert) | (~any & port->pinInvert));
+    pushedAny = (uint16_t)((any & ~port->pinInvert) | (~all & port->pinInvert));
+
+    /* settled pins take their level, bouncing pins keep the last one */
+    return ((uint32_t)pushedAll | (stable & pushedAny)) & port->pinMask;
+}
+
+/**
+ * @brief           Handle the batches which are filled since the last call.
+ *
+ * @param[inout]    self - The pointer of the scanner.
+ *
+ * @return          The number of batches handled.
+ *
+ * @note            Cost : one AND/OR pass over the samples of each port, plus
+ *                  the state machine of the keys which are pushed or not idle,
+ *                  once per batch. Nothing is done if no transfer event came.
+ *                  The timing of the keys is read when the batch is handled, so
+ *                  an event can be late by the time of one half of the buffer.
+ */
+SIMPLEBTN_C_API HOT_ uint32_t
+SimpleButton_DmaScan_Handler(
+    SimpleButton_Type_DmaScanner_t* const self
+) {
+    const uint16_t half = (uint16_t)(self->depth / 2U);
+    uint32_t count = 0;
+
+    for (;;) {
+        const uint8_t bit = (uint8_t)(self->nextHalf ? 2U : 1U);
+        const uint16_t offset = (uint16_t)(self->nextHalf ? half : 0U);
+        uint8_t is_ready;
+        uint8_t port;
+
+        SIMPLEBTN_FUNC_CRITICAL_SECTION_BEGIN(); /* critical section begin */
+        is_ready = (uint8_t)(self->pending & bit);
+        self->pending &= (uint8_t)~bit;
+        SIMPLEBTN_FUNC_CRITICAL_SECTION_END(); /* critical section end */
+
+        if (!is_ready) {
+            return count;
+        }
+
+        for (port = 0; port < self->portCount; port++) {
+            const uint16_t firstKey = (uint16_t)(port * SIMPLEBTN_DMA_PORT_PINS);
+
+            self->stable[port] = simpleButton_Private_Dma_Debounce(
+                &(self->buffer[(uint32_t)port * self->depth + offset]),
+                half,
+                &(self->config.ports[port]),
+                self->stable[port]
+            );
+
+            self->active[port] = simpleButton_Private_ScanWord(
+                &(self->keys[firstKey]),
+                self->stable[port],
+                self->active[port],
+                &(self->callBacks),
+                &(self->currentKey),
+                firstKey
+            );
+        }
+
+        self->nextHalf ^= 1U;
+        self->batches ++;
+        count ++;
+    }
+}
+
+/**
+ * @brief           Get the `Public` config of a key, to change its adjustable time,
+ *                  pressed/released events, ...
+ *
+ * @return          The pointer of `Public`, or 0 if the key does not exist.
+ */
+SIMPLEBTN_C_API simpleButton_Type_PublicBtnStatus_t*
+SimpleButton_DmaScan_GetKeyPublic(
+    SimpleButton_Type_DmaScanner_t* const self,
+    uint8_t port,
+    uint8_t pin
+) {
+    if (port >= self->portCount || pin >= SIMPLEBTN_DMA_PORT_PINS) {
+        return 0;
+    }
+
+    return &(self->keys[(uint16_t)port * SIMPLEBTN_DMA_PORT_PINS + pin].Public);
+}
+
+/**
+ * @brief           Check whether all the keys of the scanner are idle.
+ *
+ * @return          Non-zero if all of them are in `Wait_For_Interrupt` state.
+ */
+SIMPLEBTN_C_API uint32_t
+SimpleButton_DmaScan_AllIdle(
+    SimpleButton_Type_DmaScanner_t* const self
+) {
+    uint8_t port;
+
+    for (port = 0; port < self->portCount; port++) {
+        if (self->active[port] != 0 || self->stable[port] != 0) {
+            return 0;
+        }
+    }
+
+    return 1;
+}
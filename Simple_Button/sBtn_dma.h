@@ -0,0 +1,239 @@
+/**
+ * @file            sBtn_dma.h
+ *
+ * @author          Kim-J-Smith
+ *
+ * @brief           Header file of the DMA scanning engine. A hardware timer
+ *                  triggers DMA transfers of the GPIO input registers into a
+ *                  circular buffer, and the CPU only handles the buffer in
+ *                  batches, on the half / full transfer events.
+ *
+ * @version         0.8.x
+ *
+ * @date            2025-10-03
+ *
+ * @attention       Copyright (c) 2025 Kim-J-Smith.
+ *                  All rights reserved.
+ *
+ * @copyright       SPDX-License-Identifier: MIT
+ *                  Refer to the LICENCE file in root for more details.
+ *                  <https://github.com/Kim-J-Smith/Simple-Button>
+ */
+#ifndef     SIMPLEBUTTON_DMA_H__
+#define     SIMPLEBUTTON_DMA_H__        1020L
+
+#include    "Simple_Button.h"
+#if ( SIMPLEBUTTON_DMA_H__ != SIMPLEBUTTON_H__ )
+ #warning [Simple-Button] : the version of "sBtn_dma.h"\
+ is different from it of "Simple_Button.h".
+#endif /* SIMPLEBUTTON_DMA_H__ != SIMPLEBUTTON_H__ */
+
+/* The number of keys of a port */
+#define SIMPLEBTN_DMA_PORT_PINS                 16U
+
+/* One GPIO port sampled by DMA. Key (port, pin) is `keys[port * 16 + pin]`. */
+typedef struct SimpleButton_Type_DmaPort_t {
+
+    simpleButton_Type_GPIOBase_t    GPIO_Base;
+
+    uint16_t    pinMask;    /* pins which are buttons */
+
+    uint16_t    pinInvert;  /* pins whose pushed level is 0 (usually all of them) */
+
+} SimpleButton_Type_DmaPort_t;
+
+/**
+ * Start the timer-triggered circular DMA of all the ports: at each trigger,
+ * the input register of port P is copied into `buffer[P * depth + i]`, `i`
+ * wraps around at `depth`. Call `SimpleButton_DmaScan_TransferEvent()` on
+ * the half / full transfer events of port 0.
+ */
+typedef void (* SimpleButton_Type_DmaStart_t)(
+    void* context,
+    const SimpleButton_Type_DmaPort_t* ports,
+    uint8_t portCount,
+    volatile uint16_t* buffer,
+    uint16_t depth
+);
+
+/* Stop the timer and the DMA. */
+typedef void (* SimpleButton_Type_DmaStop_t)(void* context);
+
+/**
+ * @struct      SimpleButton_Type_DmaScanConfig_t
+ *
+ * @brief       The platform hooks and the ports of a DMA scanner.
+ */
+typedef struct SimpleButton_Type_DmaScanConfig_t {
+
+    SimpleButton_Type_DmaStart_t        start;
+
+    SimpleButton_Type_DmaStop_t         stop;
+
+    void*                               context; /* passed to the hooks */
+
+    const SimpleButton_Type_DmaPort_t*  ports; /* must stay valid */
+
+} SimpleButton_Type_DmaScanConfig_t;
+
+/**
+ * @struct      SimpleButton_Type_DmaScanner_t
+ *
+ * @brief       The DMA scanner object.
+ *
+ * @note        `stable[P]` is the debounced level of port P : a pin is pushed
+ *              (released) when all the samples of a batch say so, otherwise
+ *              it keeps its level. The state machine runs once per batch.
+ */
+typedef struct SimpleButton_Type_DmaScanner_t {
+
+    simpleButton_Type_VirtualKey_t* keys;
+
+    volatile uint16_t*              buffer; /* `depth` samples of each port */
+
+    uint32_t*                       stable; /* pushed pins of each port (debounced) */
+
+    uint32_t*                       active; /* keys which are not idle */
+
+    SimpleButton_Type_DmaScanConfig_t config;
+
+    simpleButton_Type_CallBackSet_t callBacks;
+
+    uint32_t                        batches; /* halves handled */
+
+    uint32_t                        overruns; /* halves overwritten before they were handled */
+
+    volatile uint16_t               currentKey; /* the key whose callback is running */
+
+    uint16_t                        depth;
+
+    volatile uint8_t                pending; /* bit 0 : first half ready, bit 1 : second half ready */
+
+    uint8_t                         nextHalf;
+
+    uint8_t                         portCount;
+
+} SimpleButton_Type_DmaScanner_t;
+
+/**
+ * @def         SIMPLEBTN__DMASCAN_CREATE
+ * @brief       Create a DMA scanner with static storage.
+ * @param[in]   __ports - The number of GPIO ports. (1 ~ 255)
+ * @param[in]   __depth - The samples of each port in the circular buffer. (even, 2 ~ 65534)
+ * @param[in]   __name - The name of the scanner.
+ * @note        Initialize it with `prefix/namespace` + `__name` + `_Init(&config)`.
+ */
+#define SIMPLEBTN__DMASCAN_CREATE(__ports, __depth, __name)                     \
+    static simpleButton_Type_VirtualKey_t                                       \
+    SIMPLEBTN_CONNECT2(simpleButton_Private_DmaKeys_, __name)[                  \
+        SIMPLEBTN_DMA_PORT_PINS * (__ports)];                                   \
+                                                                                \
+    static volatile uint16_t                                                    \
+    SIMPLEBTN_CONNECT2(simpleButton_Private_DmaBuffer_, __name)[(__ports) * (__depth)]; \
+                                                                                \
+    static uint32_t                                                             \
+    SIMPLEBTN_CONNECT2(simpleButton_Private_DmaWords_, __name)[2 * (__ports)];  \
+                                                                                \
+    SimpleButton_Type_DmaScanner_t                                              \
+    SIMPLEBTN_CONNECT2(SIMPLEBTN_NAMESPACE, __name);                            \
+                                                                                \
+    SIMPLEBTN_C_API void                                                        \
+    SIMPLEBTN_CONNECT3(SIMPLEBTN_NAMESPACE, __name, _Init)(                     \
+        const SimpleButton_Type_DmaScanConfig_t* const config                   \
+    ) {                                                                         \
+        SimpleButton_DmaScan_Init(                                              \
+            &(SIMPLEBTN_CONNECT2(SIMPLEBTN_NAMESPACE, __name)),                 \
+            SIMPLEBTN_CONNECT2(simpleButton_Private_DmaKeys_, __name),          \
+            SIMPLEBTN_CONNECT2(simpleButton_Private_DmaBuffer_, __name),        \
+            SIMPLEBTN_CONNECT2(simpleButton_Private_DmaWords_, __name),         \
+            (uint8_t)(__ports),                                                 \
+            (uint16_t)(__depth),                                                \
+            config                                                              \
+        );                                                                      \
+    }
+
+/**
+ * @def         SIMPLEBTN__DMASCAN_DECLARE
+ * @param[in]   __name - The name of scanner.
+ */
+#define SIMPLEBTN__DMASCAN_DECLARE(__name)                                      \
+    extern SimpleButton_Type_DmaScanner_t                                       \
+    SIMPLEBTN_CONNECT2(SIMPLEBTN_NAMESPACE, __name);                            \
+    SIMPLEBTN_C_API void                                                        \
+    SIMPLEBTN_CONNECT3(SIMPLEBTN_NAMESPACE, __name, _Init)(                     \
+        const SimpleButton_Type_DmaScanConfig_t* const config                   \
+    );
+
+/**
+ * @def             SIMPLEBTN__DMASCAN_SETCALLBACK
+ * @brief           Set the callback functions shared by all the keys of a scanner.
+ *                  Use `SimpleButton_DmaScan_CurrentKey()` in them to get the key.
+ */
+#define SIMPLEBTN__DMASCAN_SETCALLBACK(scanner, shortCB, longCB, repeatCB)              \
+    do {                                                                                \
+        (scanner).callBacks.shortPushCallBack = shortCB;                                \
+        (scanner).callBacks.longPushCallBack = longCB;                                  \
+        (scanner).callBacks.repeatPushCallBack = repeatCB;                              \
+    } while(0)
+
+SIMPLEBTN_C_API void
+SimpleButton_DmaScan_Init(
+    SimpleButton_Type_DmaScanner_t* const self,
+    simpleButton_Type_VirtualKey_t* const keys,
+    volatile uint16_t* const buffer,
+    uint32_t* const wordBuffer,
+    uint8_t portCount,
+    uint16_t depth,
+    const SimpleButton_Type_DmaScanConfig_t* const config
+);
+
+SIMPLEBTN_C_API void
+SimpleButton_DmaScan_Start(
+    SimpleButton_Type_DmaScanner_t* const self
+);
+
+SIMPLEBTN_C_API void
+SimpleButton_DmaScan_Stop(
+    SimpleButton_Type_DmaScanner_t* const self
+);
+
+SIMPLEBTN_C_API void
+SimpleButton_DmaScan_TransferEvent(
+    SimpleButton_Type_DmaScanner_t* const self,
+    uint8_t is_full
+);
+
+SIMPLEBTN_C_API uint32_t
+SimpleButton_DmaScan_Handler(
+    SimpleButton_Type_DmaScanner_t* const self
+);
+
+SIMPLEBTN_C_API simpleButton_Type_PublicBtnStatus_t*
+SimpleButton_DmaScan_GetKeyPublic(
+    SimpleButton_Type_DmaScanner_t* const self,
+    uint8_t port,
+    uint8_t pin
+);
+
+SIMPLEBTN_C_API uint32_t
+SimpleButton_DmaScan_AllIdle(
+    SimpleButton_Type_DmaScanner_t* const self
+);
+
+/**
+ * @brief   Get the key whose callback function is running.
+ * @return  The index of the key, `port * 16 + pin`.
+ */
+SIMPLEBTN_FORCE_INLINE uint16_t
+SimpleButton_DmaScan_CurrentKey(
+    const SimpleButton_Type_DmaScanner_t* const self
+) {
+#if SIMPLEBTN_MODE_ENABLE_DEFERRED_CALLBACK != 0
+    (void)self;
+    return SimpleButton_Deferred_CurrentKey(); /* the scanner may be on another key */
+#else
+    return self->currentKey;
+#endif /* SIMPLEBTN_MODE_ENABLE_DEFERRED_CALLBACK != 0 */
+}
+
+#endif /* SIMPLEBUTTON_DMA_H__ */
@@ -0,0 +1,148 @@
+/**
+ * @file            sBtn_encoder.c
+ *
+ * @author          Kim-J-Smith
+ *
+ * @brief           Source file of the quadrature rotary encoder. This file
+ *                  contains the interrupt decoder and the detent/velocity
+ *                  dispatcher.
+ *
+ * @version         0.8.x
+ *
+ * @date            2025-10-03
+ *
+ * @attention       Copyright (c) 2025 Kim-J-Smith.
+ *                  All rights reserved.
+ *
+ * @copyright       SPDX-License-Identifier: MIT
+ *                  Refer to the LICENCE file in root for more details.
+ *                  <https://github.com/Kim-J-Smith/Simple-Button>
+ */
+#include    "sBtn_encoder.h"
+
+
+/* HOT : Trigger hotspot optimization */
+#if defined(__GNUC__) || defined(__clang__)
+ #define HOT_ __attribute__((hot))
+#elif defined(_MSC_VER) && ( _MSC_VER >= 1900 )
+ #define HOT_ __declspec(hot)
+#else
+ #define HOT_
+#endif /* HOT */
+
+/**
+ * The quadrature transition table, indexed by `(lastAB << 2) | AB`.
+ * +1 / -1 for a valid step, 0 for no change or an invalid transition.
+ */
+static const int8_t simpleButton_Private_Encoder_Table[16] = {
+     0, -1, +1,  0,
+    +1,  0,  0, -1,
+    -1,  0,  0, +1,
+     0, +1, -1,  0,
+};
+
+/* a helper function : floor(steps / SIMPLEBTN_ENCODER_STEPS_PER_DETENT) */
+SIMPLEBTN_FORCE_INLINE int32_t
+simpleButton_Private_Encoder_Detents(const int32_t steps)
+{
+    const int32_t per_detent = SIMPLEBTN_ENCODER_STEPS_PER_DETENT;
+
+    return (steps >= 0) ? (steps / per_detent) : -((per_detent - 1 - steps) / per_detent);
+}
+
+/**
+ * @brief           Initialize the encoder.
+ *
+ * @param[inout]    self - The pointer of the encoder.
+ * @param[in]       asynchronousHandler - Function pointer of asynchronous handler.
+ * @param[in]       interruptHandler - Function pointer of interrupt handler.
+ * @param[in]       ab - The level of A (bit 1) and B (bit 0) at rest.
+ *
+ * @return          None
+ */
+SIMPLEBTN_C_API void
+SimpleButton_Encoder_Init(
+    simpleButton_Type_Encoder_t* const self,
+    simpleButton_Type_EncoderAsyHandler_t asynchronousHandler,
+    simpleButton_Type_InterruptHandler_t interruptHandler,
+    uint8_t ab
+) {
+    SIMPLEBTN_FUNC_CRITICAL_SECTION_BEGIN(); /* critical section begin */
+
+    self->Methods.asynchronousHandler = asynchronousHandler;
+    self->Methods.interruptHandler = interruptHandler;
+
+    self->Private.steps = 0;
+    self->Private.errorCount = 0;
+    self->Private.lastAB = ab;
+    self->Private.reported = 0;
+    self->Private.timeStamp_detent = SIMPLEBTN_FUNC_GET_TICK();
+
+    SIMPLEBTN_FUNC_CRITICAL_SECTION_END(); /* critical section end */
+}
+
+/**
+ * @brief           Decode one edge of A or B. Called in interrupt.
+ *
+ * @param[inout]    self_private - The status of the encoder.
+ * @param[in]       ab - The level of A (bit 1) and B (bit 0) now.
+ *
+ * @return          None
+ *
+ * @note            One table lookup and no critical section : the interrupt is
+ *                  the only writer of `steps`, which the while loop only reads.
+ */
+SIMPLEBTN_C_API HOT_ void
+simpleButton_Private_Encoder_InterruptHandler(
+    simpleButton_Type_EncoderStatus_t* const self_private,
+    const uint8_t ab
+) {
+    const uint8_t last_ab = self_private->lastAB;
+
+    if ((last_ab ^ ab) == 3U) {
+        self_private->errorCount ++; /* an edge was missed */
+    } else {
+        self_private->steps += simpleButton_Private_Encoder_Table[(last_ab << 2) | ab];
+    }
+
+    self_private->lastAB = ab;
+}
+
+/**
+ * @brief           Deliver the detents since the last call. Called in while loop.
+ *
+ * @param[inout]    self_private - The status of the encoder.
+ * @param[in]       rotateCallBack - Called with delta and velocity when the
+ *                  encoder has moved by one detent or more. (can be 0)
+ *
+ * @return          None
+ */
+SIMPLEBTN_C_API void
+simpleButton_Private_Encoder_AsynchronousHandler(
+    simpleButton_Type_EncoderStatus_t* const self_private,
+    SimpleButton_Type_EncoderCallBack_t rotateCallBack
+) {
+    const int32_t detents = simpleButton_Private_Encoder_Detents(self_private->steps);
+    const int32_t delta = detents - self_private->reported;
+    uint32_t now;
+    uint32_t elapsed;
+    uint32_t velocity;
+
+    if (delta == 0) {
+        return;
+    }
+
+    now = SIMPLEBTN_FUNC_GET_TICK();
+    elapsed = now - self_private->timeStamp_detent;
+    if (elapsed == 0) {
+        elapsed = 1;
+    }
+    velocity = (uint32_t)((delta >= 0) ? delta : -delta) * 1000U / elapsed;
+
+    self_private->reported = detents;
+    self_private->timeStamp_detent = now;
+
+    if (rotateCallBack != 0) {
+        rotateCallBack(delta, velocity);
+    }
+}
@@ -0,0 +1,164 @@
+/**
+ * @file            sBtn_encoder.h
+ *
+ * @author          Kim-J-Smith
+ *
+ * @brief           Header file of the quadrature rotary encoder. The A/B
+ *                  edges are decoded in the EXTI interrupt with a transition
+ *                  table, and the detents are delivered as delta/velocity
+ *                  events in the while loop, like the button callbacks.
+ *
+ * @version         0.8.x
+ *
+ * @date            2025-10-03
+ *
+ * @attention       Copyright (c) 2025 Kim-J-Smith.
+ *                  All rights reserved.
+ *
+ * @copyright       SPDX-License-Identifier: MIT
+ *                  Refer to the LICENCE file in root for more details.
+ *                  <https://github.com/Kim-J-Smith/Simple-Button>
+ */
+#ifndef     SIMPLEBUTTON_ENCODER_H__
+#define     SIMPLEBUTTON_ENCODER_H__    1020L
+
+#include    "Simple_Button.h"
+#if ( SIMPLEBUTTON_ENCODER_H__ != SIMPLEBUTTON_H__ )
+ #warning [Simple-Button] : the version of "sBtn_encoder.h"\
+ is different from it of "Simple_Button.h".
+#endif /* SIMPLEBUTTON_ENCODER_H__ != SIMPLEBUTTON_H__ */
+
+/* The quadrature steps of one detent (most mechanical encoders : 4) */
+#ifndef SIMPLEBTN_ENCODER_STEPS_PER_DETENT
+ #define SIMPLEBTN_ENCODER_STEPS_PER_DETENT     4
+#endif /* SIMPLEBTN_ENCODER_STEPS_PER_DETENT */
+
+/**
+ * The rotate callback function.
+ * `delta` : detents since the last call, positive for A leading B.
+ * `velocity` : detents per second.
+ */
+typedef void (* SimpleButton_Type_EncoderCallBack_t)(int32_t delta, uint32_t velocity);
+
+/* The asynchronous handler of an encoder, called in while loop. */
+typedef void (* simpleButton_Type_EncoderAsyHandler_t)(SimpleButton_Type_EncoderCallBack_t rotateCallBack);
+
+/* The status of an encoder. (internal use) */
+typedef struct simpleButton_Type_EncoderStatus_t {
+
+    volatile int32_t    steps; /* quadrature steps, only written in interrupt */
+
+    volatile uint32_t   errorCount; /* invalid transitions (both A and B changed), only written in interrupt */
+
+    volatile uint8_t    lastAB; /* only written in interrupt */
+
+    int32_t             reported; /* detents already delivered, only used in while loop */
+
+    uint32_t            timeStamp_detent; /* only used in while loop */
+
+} simpleButton_Type_EncoderStatus_t;
+
+/* The methods of an encoder. */
+typedef struct simpleButton_Type_EncoderMethod_t {
+
+    simpleButton_Type_EncoderAsyHandler_t asynchronousHandler;
+
+    simpleButton_Type_InterruptHandler_t interruptHandler;
+
+} simpleButton_Type_EncoderMethod_t;
+
+/**
+ * @struct      simpleButton_Type_Encoder_t
+ *
+ * @brief       The rotary encoder object. Its push switch is a normal button
+ *              created by `SIMPLEBTN__CREATE()`.
+ */
+typedef struct simpleButton_Type_Encoder_t {
+
+    simpleButton_Type_EncoderMethod_t Methods;
+
+    simpleButton_Type_EncoderStatus_t Private;
+
+} simpleButton_Type_Encoder_t;
+
+/* Read the level of A (bit 1) and B (bit 0) */
+#define SIMPLEBTN_ENCODER_READ_AB(GPIOx_BASE_A, GPIO_Pin_A, GPIOx_BASE_B, GPIO_Pin_B) \
+    ((uint8_t)(((SIMPLEBTN_FUNC_READ_PIN((GPIOx_BASE_A), (GPIO_Pin_A)) != 0) ? 2U : 0U) \
+             | ((SIMPLEBTN_FUNC_READ_PIN((GPIOx_BASE_B), (GPIO_Pin_B)) != 0) ? 1U : 0U)))
+
+/**
+ * @def         SIMPLEBTN__ENCODER_CREATE
+ * @brief       Create a quadrature rotary encoder statically.
+ * @param[in]   GPIOx_BASE_A / GPIO_Pin_A - The pin of channel A.
+ * @param[in]   GPIOx_BASE_B / GPIO_Pin_B - The pin of channel B.
+ * @param[in]   EXTI_Trigger_AB - The EXTI trigger of both edges on the platform.
+ * @param[in]   __name - The name of the encoder.
+ * @note        Initialize it with `prefix/namespace` + `__name` + `_Init()`.
+ *              Call `.Methods.interruptHandler()` in the EXTI interrupt of both
+ *              A and B, and `.Methods.asynchronousHandler(rotateCB)` in while loop.
+ */
+#define SIMPLEBTN__ENCODER_CREATE(GPIOx_BASE_A, GPIO_Pin_A, GPIOx_BASE_B, GPIO_Pin_B, EXTI_Trigger_AB, __name) \
+    simpleButton_Type_Encoder_t                                                 \
+    SIMPLEBTN_CONNECT2(SIMPLEBTN_NAMESPACE, __name) = {0};                      \
+                                                                                \
+    static void                                                                 \
+    SIMPLEBTN_CONNECT2(simpleButton_Private_EncAsyHandler_, __name)(            \
+        SimpleButton_Type_EncoderCallBack_t rotateCallBack                      \
+    ) {                                                                         \
+        simpleButton_Private_Encoder_AsynchronousHandler(                       \
+            &(SIMPLEBTN_CONNECT2(SIMPLEBTN_NAMESPACE, __name).Private),         \
+            rotateCallBack                                                      \
+        );                                                                      \
+    }                                                                           \
+                                                                                \
+    static void                                                                 \
+    SIMPLEBTN_CONNECT2(simpleButton_Private_EncITHandler_, __name)(void) {      \
+        simpleButton_Private_Encoder_InterruptHandler(                          \
+            &(SIMPLEBTN_CONNECT2(SIMPLEBTN_NAMESPACE, __name).Private),         \
+            SIMPLEBTN_ENCODER_READ_AB(GPIOx_BASE_A, GPIO_Pin_A, GPIOx_BASE_B, GPIO_Pin_B) \
+        );                                                                      \
+    }                                                                           \
+                                                                                \
+    SIMPLEBTN_C_API void                                                        \
+    SIMPLEBTN_CONNECT3(SIMPLEBTN_NAMESPACE, __name, _Init)(void) {              \
+        SimpleButton_Encoder_Init(                                              \
+            &(SIMPLEBTN_CONNECT2(SIMPLEBTN_NAMESPACE, __name)),                 \
+            &(SIMPLEBTN_CONNECT2(simpleButton_Private_EncAsyHandler_, __name)), \
+            &(SIMPLEBTN_CONNECT2(simpleButton_Private_EncITHandler_, __name)),  \
+            SIMPLEBTN_ENCODER_READ_AB(GPIOx_BASE_A, GPIO_Pin_A, GPIOx_BASE_B, GPIO_Pin_B) \
+        );                                                                      \
+        SIMPLEBTN_FUNC_INIT_EXTI((GPIOx_BASE_A), (GPIO_Pin_A), (EXTI_Trigger_AB)); \
+        SIMPLEBTN_FUNC_INIT_EXTI((GPIOx_BASE_B), (GPIO_Pin_B), (EXTI_Trigger_AB)); \
+    }
+
+/**
+ * @def         SIMPLEBTN__ENCODER_DECLARE
+ * @param[in]   __name - The name of encoder.
+ */
+#define SIMPLEBTN__ENCODER_DECLARE(__name)                                      \
+    extern simpleButton_Type_Encoder_t                                          \
+    SIMPLEBTN_CONNECT2(SIMPLEBTN_NAMESPACE, __name);                            \
+    SIMPLEBTN_C_API void                                                        \
+    SIMPLEBTN_CONNECT3(SIMPLEBTN_NAMESPACE, __name, _Init)(void);
+
+SIMPLEBTN_C_API void
+SimpleButton_Encoder_Init(
+    simpleButton_Type_Encoder_t* const self,
+    simpleButton_Type_EncoderAsyHandler_t asynchronousHandler,
+    simpleButton_Type_InterruptHandler_t interruptHandler,
+    uint8_t ab
+);
+
+SIMPLEBTN_C_API void
+simpleButton_Private_Encoder_InterruptHandler(
+    simpleButton_Type_EncoderStatus_t* const self_private,
+    const uint8_t ab
+);
+
+SIMPLEBTN_C_API void
+simpleButton_Private_Encoder_AsynchronousHandler(
+    simpleButton_Type_EncoderStatus_t* const self_private,
+    SimpleButton_Type_EncoderCallBack_t rotateCallBack
+);
+
+#endif /* SIMPLEBUTTON_ENCODER_H__ */
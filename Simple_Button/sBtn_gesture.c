@@ -0,0 +1,380 @@
+/**
+ * @file            sBtn_gesture.c
+ *
+ * @author          Kim-J-Smith
+ *
+ * @brief           Source file of the gesture recognizer. This file contains
+ *                  the pattern compiler (Aho-Corasick, resolved into a full
+ *                  DFA) and the O(1) matcher.
+ *
+ * @version         0.8.x
+ *
+ * @date            2025-10-03
+ *
+ * @attention       Copyright (c) 2025 Kim-J-Smith.
+ *                  All rights reserved.
+ *
+ * @copyright       SPDX-License-Identifier: MIT
+ *                  Refer to the LICENCE file in root for more details.
+ *                  <https://github.com/Kim-J-Smith/Simple-Button>
+ */
+#include    "sBtn_gesture.h"
+
+/* The missing edge of the trie while compiling */
+#define SIMPLEBTN_GESTURE_NONE_                 0xFFU
+
+/* The flags of a state : a pattern ends at it / a longer pattern goes on from it */
+#define SIMPLEBTN_GESTURE_OWN_                  0x01U
+#define SIMPLEBTN_GESTURE_LONGER_               0x02U
+
+/**
+ * @brief           Initialize the recognizer and compile the patterns.
+ *
+ * @param[inout]    self - The pointer of the recognizer.
+ * @param[in]       nextBuffer - Storage of `maxStates * maxClasses` bytes.
+ * @param[in]       workBuffer - Storage of `5 * maxStates` bytes.
+ * @param[in]       maxStates - Total length of all the patterns + 1.
+ * @param[in]       maxClasses - Different symbols of all the patterns + 1.
+ * @param[in]       patterns - The patterns. (only read here)
+ * @param[in]       patternCount - The number of patterns. (1 ~ 254)
+ *
+ * @return          None
+ *
+ * @note            A pattern which ends inside a longer one is also found,
+ *                  so "short-long" inside "short-short-long" matches too.
+ *                  A pattern which is the beginning of a longer one waits for
+ *                  it : "short" is reported when the next event breaks
+ *                  "short-short-long", or after `timeout` (see
+ *                  `SimpleButton_Gesture_Handler()`). The sequence restarts
+ *                  after a match.
+ *
+ * @note            Too small `maxStates` or `maxClasses` panics if SIMPLEBTN_DEBUG.
+ *                  Otherwise the patterns are truncated : the extra symbols fall
+ *                  into class 0 (the symbols of no pattern, so they also match
+ *                  any unknown symbol), and a pattern which does not fit in the
+ *                  states is never matched.
+ */
+SIMPLEBTN_C_API void
+SimpleButton_Gesture_Init(
+    SimpleButton_Type_Gesture_t* const self,
+    uint8_t* const nextBuffer,
+    uint8_t* const workBuffer,
+    uint8_t maxStates,
+    uint8_t maxClasses,
+    const SimpleButton_Type_GesturePattern_t* const patterns,
+    uint8_t patternCount
+) {
+    uint8_t* const fail = workBuffer + 3 * maxStates; /* the history after the init */
+    uint8_t* const queue = workBuffer + 4 * maxStates;
+    uint16_t i;
+    uint16_t head = 0;
+    uint16_t tail = 0;
+    uint8_t p;
+    uint8_t c;
+
+#if defined(SIMPLEBTN_DEBUG)
+    if (0 == self || 0 == nextBuffer || 0 == workBuffer || 0 == patterns
+        || maxStates < 2 || maxStates == 0xFF || maxClasses < 2
+        || patternCount == 0 || patternCount == 0xFF
+    ) {
+        SIMPLEBTN_FUNC_PANIC(
+            "invalid input in func:SimpleButton_Gesture_Init",
+            simpleButton_ErrorNum_invalidInput,
+        );
+    }
+#endif /* defined(SIMPLEBTN_DEBUG) */
+
+    SIMPLEBTN_FUNC_CRITICAL_SECTION_BEGIN(); /* critical section begin */
+
+    self->next = nextBuffer;
+    self->accept = workBuffer;
+    self->depth = workBuffer + maxStates;
+    self->flags = workBuffer + 2 * maxStates;
+    self->history = fail;
+    self->callBack = 0;
+    self->timeStamp_event = SIMPLEBTN_FUNC_GET_TICK();
+    self->timeout = SIMPLEBTN_TIME_GESTURE_TIMEOUT;
+    self->state = 0;
+    self->pending = SIMPLEBTN_GESTURE_NO_MATCH;
+    self->historyLength = 0;
+    self->stateCount = 1;
+    self->classCount = 1;
+
+    /* 1. give every symbol used by the patterns its own class */
+    for (i = 0; i < 256; i++) {
+        self->classOf[i] = 0;
+    }
+    for (p = 0; p < patternCount; p++) {
+        for (i = 0; i < patterns[p].length; i++) {
+            const uint8_t symbol = patterns[p].symbols[i];
+            if (self->classOf[symbol] == 0) {
+                if (self->classCount >= maxClasses) {
+#if defined(SIMPLEBTN_DEBUG)
+                    SIMPLEBTN_FUNC_PANIC(
+                        "too many classes in func:SimpleButton_Gesture_Init",
+                        simpleButton_ErrorNum_invalidInput,
+                    );
+#endif /* defined(SIMPLEBTN_DEBUG) */
+                    continue;
+                }
+                self->classOf[symbol] = self->classCount ++;
+            }
+        }
+    }
+
+    /* 2. build the trie */
+    for (i = 0; i < (uint16_t)maxStates * maxClasses; i++) {
+        nextBuffer[i] = SIMPLEBTN_GESTURE_NONE_;
+    }
+    for (i = 0; i < maxStates; i++) {
+        self->accept[i] = 0;
+        self->depth[i] = 0;
+        self->flags[i] = 0;
+    }
+    for (p = 0; p < patternCount; p++) {
+        uint8_t state = 0;
+
+        for (i = 0; i < patterns[p].length; i++) {
+            uint8_t* const edge = &(nextBuffer[state * self->classCount + self->classOf[patterns[p].symbols[i]]]);
+
+            if (*edge == SIMPLEBTN_GESTURE_NONE_) {
+                if (self->stateCount >= maxStates) {
+#if defined(SIMPLEBTN_DEBUG)
+                    SIMPLEBTN_FUNC_PANIC(
+                        "too many states in func:SimpleButton_Gesture_Init",
+                        simpleButton_ErrorNum_invalidInput,
+                    );
+#endif /* defined(SIMPLEBTN_DEBUG) */
+                    break;
+                }
+                *edge = self->stateCount ++;
+                self->depth[*edge] = (uint8_t)(self->depth[state] + 1U);
+            }
+            self->flags[state] |= SIMPLEBTN_GESTURE_LONGER_;
+            state = *edge;
+        }
+
+        if (i == patterns[p].length && patterns[p].length != 0 && self->accept[state] == 0) {
+            self->accept[state] = (uint8_t)(p + 1);
+            self->flags[state] |= SIMPLEBTN_GESTURE_OWN_;
+        }
+    }
+
+    /* 3. resolve the missing edges through the failure links (BFS) */
+    for (c = 0; c < self->classCount; c++) {
+        const uint8_t child = nextBuffer[c];
+
+        if (child == SIMPLEBTN_GESTURE_NONE_) {
+            nextBuffer[c] = 0;
+        } else {
+            fail[child] = 0;
+            queue[tail ++] = child;
+        }
+    }
+    while (head < tail) {
+        const uint8_t state = queue[head ++];
+
+        for (c = 0; c < self->classCount; c++) {
+            uint8_t* const edge = &(nextBuffer[state * self->classCount + c]);
+            const uint8_t fallback = nextBuffer[fail[state] * self->classCount + c];
+
+            if (*edge == SIMPLEBTN_GESTURE_NONE_) {
+                *edge = fallback;
+            } else {
+                fail[*edge] = fallback;
+                if (self->accept[*edge] == 0) {
+                    self->accept[*edge] = self->accept[fallback];
+                }
+                queue[tail ++] = *edge;
+            }
+        }
+    }
+
+    SIMPLEBTN_FUNC_CRITICAL_SECTION_END(); /* critical section end */
+}
+
+/* a helper function : report a match and restart the sequence */
+static uint8_t
+simpleButton_Private_Gesture_Fire(
+    SimpleButton_Type_Gesture_t* const self,
+    const uint8_t pattern
+) {
+    self->state = 0;
+    self->pending = SIMPLEBTN_GESTURE_NO_MATCH;
+
+    if (self->callBack != 0) {
+        self->callBack(pattern);
+    }
+
+    return pattern;
+}
+
+/* a helper function : forget the first `count` classes of the history */
+SIMPLEBTN_FORCE_INLINE void
+simpleButton_Private_Gesture_Forget(
+    SimpleButton_Type_Gesture_t* const self,
+    const uint8_t count
+) {
+    uint8_t i;
+
+    for (i = count; i < self->historyLength; i++) {
+        self->history[i - count] = self->history[i];
+    }
+    self->historyLength = (uint8_t)(self->historyLength - count);
+}
+
+/**
+ * @brief           Run the history from its class `done` on.
+ *
+ * @param[inout]    self - The pointer of the recognizer.
+ * @param[in]       done - The classes before it were already run.
+ *
+ * @return          The index of the last completed pattern, or `SIMPLEBTN_GESTURE_NO_MATCH`.
+ *
+ * @note            While a match waits, the history keeps the classes after it.
+ *                  If one of them leaves the trie path of the longer patterns,
+ *                  the waiting match is reported and they are run again from
+ *                  the start, so no event is lost.
+ */
+static uint8_t
+simpleButton_Private_Gesture_Run(
+    SimpleButton_Type_Gesture_t* const self,
+    uint8_t done
+) {
+    uint8_t result = SIMPLEBTN_GESTURE_NO_MATCH;
+
+    while (done < self->historyLength) {
+        const uint8_t next = self->next[self->state * self->classCount + self->history[done]];
+
+        if (self->pending != SIMPLEBTN_GESTURE_NO_MATCH) {
+            if (self->depth[next] != self->depth[self->state] + 1U) {
+                result = simpleButton_Private_Gesture_Fire(self, self->pending);
+                done = 0; /* the longer pattern is broken */
+                continue;
+            }
+        }
+
+        self->state = next;
+        done ++;
+
+        if (self->pending == SIMPLEBTN_GESTURE_NO_MATCH) {
+            simpleButton_Private_Gesture_Forget(self, done); /* nothing waits for it */
+            done = 0;
+            if (self->accept[next] == 0) {
+                continue;
+            }
+        } else if ((self->flags[next] & SIMPLEBTN_GESTURE_OWN_) == 0) {
+            continue; /* on the way to the longer pattern */
+        } else {
+            simpleButton_Private_Gesture_Forget(self, done); /* the longer pattern wins */
+            done = 0;
+        }
+
+        if (self->flags[next] & SIMPLEBTN_GESTURE_LONGER_) {
+            self->pending = (uint8_t)(self->accept[next] - 1U);
+        } else {
+            result = simpleButton_Private_Gesture_Fire(self, (uint8_t)(self->accept[next] - 1U));
+        }
+    }
+
+    return result;
+}
+
+/* a helper function : report the waiting matches, the sequence is over */
+static uint8_t
+simpleButton_Private_Gesture_Flush(
+    SimpleButton_Type_Gesture_t* const self
+) {
+    uint8_t result = SIMPLEBTN_GESTURE_NO_MATCH;
+    uint8_t pattern;
+
+    while (self->pending != SIMPLEBTN_GESTURE_NO_MATCH) {
+        result = simpleButton_Private_Gesture_Fire(self, self->pending);
+        pattern = simpleButton_Private_Gesture_Run(self, 0);
+        if (pattern != SIMPLEBTN_GESTURE_NO_MATCH) {
+            result = pattern;
+        }
+    }
+
+    /* what is left is only a part of a pattern */
+    self->state = 0;
+    self->historyLength = 0;
+
+    return result;
+}
+
+/**
+ * @brief           Feed one event into the recognizer.
+ *
+ * @param[inout]    self - The pointer of the recognizer.
+ * @param[in]       symbol - `SIMPLEBTN_GESTURE_SYMBOL(button, event)`.
+ *
+ * @return          The index of the completed pattern, or `SIMPLEBTN_GESTURE_NO_MATCH`.
+ *
+ * @note            One table lookup, however many patterns there are. The
+ *                  callback (if set) is also called with the pattern index.
+ *                  When the event also reports a waiting match, the callback
+ *                  is called for each, and the last one is returned.
+ */
+SIMPLEBTN_C_API uint8_t
+SimpleButton_Gesture_Feed(
+    SimpleButton_Type_Gesture_t* const self,
+    uint8_t symbol
+) {
+    const uint32_t now = SIMPLEBTN_FUNC_GET_TICK();
+    uint8_t result = SIMPLEBTN_GESTURE_NO_MATCH;
+    uint8_t pattern;
+
+    if ((uint32_t)(now - self->timeStamp_event) > self->timeout) {
+        result = simpleButton_Private_Gesture_Flush(self); /* too slow, start again */
+    }
+    self->timeStamp_event = now;
+
+    self->history[self->historyLength ++] = self->classOf[symbol];
+    pattern = simpleButton_Private_Gesture_Run(self, (uint8_t)(self->historyLength - 1U));
+
+    return (pattern != SIMPLEBTN_GESTURE_NO_MATCH) ? pattern : result;
+}
+
+/**
+ * @brief           Report the waiting match when `timeout` is over.
+ *
+ * @param[inout]    self - The pointer of the recognizer.
+ *
+ * @return          The index of the reported pattern, or `SIMPLEBTN_GESTURE_NO_MATCH`.
+ *
+ * @note            Call it in the while loop, only needed when some patterns
+ *                  are the beginning of longer ones.
+ */
+SIMPLEBTN_C_API uint8_t
+SimpleButton_Gesture_Handler(
+    SimpleButton_Type_Gesture_t* const self
+) {
+    if (self->pending == SIMPLEBTN_GESTURE_NO_MATCH
+        || (uint32_t)(SIMPLEBTN_FUNC_GET_TICK() - self->timeStamp_event) <= self->timeout
+    ) {
+        return SIMPLEBTN_GESTURE_NO_MATCH;
+    }
+
+    return simpleButton_Private_Gesture_Flush(self);
+}
+
+/**
+ * @brief           Feed the result of a repeat-push callback.
+ *
+ * @param[inout]    self - The pointer of the recognizer.
+ * @param[in]       button - The button. (0 ~ 63)
+ * @param[in]       repeatCount - The count given to the repeat-push callback.
+ *
+ * @return          The same as `SimpleButton_Gesture_Feed()`.
+ */
+SIMPLEBTN_C_API uint8_t
+SimpleButton_Gesture_FeedRepeat(
+    SimpleButton_Type_Gesture_t* const self,
+    uint8_t button,
+    uint8_t repeatCount
+) {
+    return SimpleButton_Gesture_Feed(self, SIMPLEBTN_GESTURE_SYMBOL(button,
+        (repeatCount <= 1) ? SimpleButton_Gesture_Short
+        : ((repeatCount == 2) ? SimpleButton_Gesture_Double : SimpleButton_Gesture_Multi)));
+}
@@ -0,0 +1,188 @@
+/**
+ * @file            sBtn_gesture.h
+ *
+ * @author          Kim-J-Smith
+ *
+ * @brief           Header file of the gesture recognizer. The short/long/
+ *                  repeat results of the buttons are fed as symbols, and
+ *                  matched against user patterns (short-short-long, long
+ *                  then double-click, ...) compiled at init into a DFA.
+ *
+ * @version         0.8.x
+ *
+ * @date            2025-10-03
+ *
+ * @attention       Copyright (c) 2025 Kim-J-Smith.
+ *                  All rights reserved.
+ *
+ * @copyright       SPDX-License-Identifier: MIT
+ *                  Refer to the LICENCE file in root for more details.
+ *                  <https://github.com/Kim-J-Smith/Simple-Button>
+ */
+#ifndef     SIMPLEBUTTON_GESTURE_H__
+#define     SIMPLEBUTTON_GESTURE_H__    1020L
+
+#include    "Simple_Button.h"
+#if ( SIMPLEBUTTON_GESTURE_H__ != SIMPLEBUTTON_H__ )
+ #warning [Simple-Button] : the version of "sBtn_gesture.h"\
+ is different from it of "Simple_Button.h".
+#endif /* SIMPLEBUTTON_GESTURE_H__ != SIMPLEBUTTON_H__ */
+
+/* Returned by `SimpleButton_Gesture_Feed()` when no pattern is completed */
+#define SIMPLEBTN_GESTURE_NO_MATCH              0xFFU
+
+/**
+ * @enum    SimpleButton_Type_GestureEvent_t
+ *
+ * @brief   The result of one interaction with a button.
+ */
+typedef enum SimpleButton_Type_GestureEvent_t {
+
+    SimpleButton_Gesture_Short = 0,
+
+    SimpleButton_Gesture_Long,
+
+    SimpleButton_Gesture_Double, /* repeat-push, 2 times */
+
+    SimpleButton_Gesture_Multi, /* repeat-push, 3 times or more */
+
+} SimpleButton_Type_GestureEvent_t;
+
+/* The symbol of an event of a button. (button : 0 ~ 63) */
+#define SIMPLEBTN_GESTURE_SYMBOL(button, event)  ((uint8_t)((((button) & 0x3FU) << 2) | ((event) & 0x03U)))
+
+/* The callback function when the pattern `pattern` is completed. */
+typedef void (* SimpleButton_Type_GestureCallBack_t)(uint8_t pattern);
+
+/**
+ * @struct      SimpleButton_Type_GesturePattern_t
+ *
+ * @brief       One pattern : a sequence of `SIMPLEBTN_GESTURE_SYMBOL()`.
+ */
+typedef struct SimpleButton_Type_GesturePattern_t {
+
+    const uint8_t*      symbols;
+
+    uint8_t             length;
+
+} SimpleButton_Type_GesturePattern_t;
+
+/**
+ * @struct      SimpleButton_Type_Gesture_t
+ *
+ * @brief       The gesture recognizer object.
+ *
+ * @note        `next[state * classCount + classOf[symbol]]` is the DFA. The
+ *              symbols not used by any pattern share class 0.
+ */
+typedef struct SimpleButton_Type_Gesture_t {
+
+    uint8_t*            next;
+
+    uint8_t*            accept; /* pattern index + 1 of each state, 0 for none */
+
+    uint8_t*            depth; /* the length of the trie path of each state */
+
+    uint8_t*            flags; /* own pattern / longer patterns of each state */
+
+    uint8_t*            history; /* the classes fed after the waiting match */
+
+    uint8_t             classOf[256];
+
+    SimpleButton_Type_GestureCallBack_t callBack;
+
+    uint32_t            timeStamp_event;
+
+    uint32_t            timeout; /* the sequence restarts after this idle time (ms) */
+
+    uint8_t             state;
+
+    uint8_t             pending; /* matched, waiting for a longer pattern */
+
+    uint8_t             historyLength;
+
+    uint8_t             stateCount;
+
+    uint8_t             classCount;
+
+} SimpleButton_Type_Gesture_t;
+
+/**
+ * @def         SIMPLEBTN__GESTURE_CREATE
+ * @brief       Create a gesture recognizer with static storage.
+ * @param[in]   __maxStates - Total length of all the patterns + 1. (2 ~ 254)
+ * @param[in]   __maxClasses - Different symbols of all the patterns + 1. (2 ~ 255)
+ * @param[in]   __name - The name of the recognizer.
+ * @note        Initialize it with `prefix/namespace` + `__name` + `_Init(patterns, count)`.
+ */
+#define SIMPLEBTN__GESTURE_CREATE(__maxStates, __maxClasses, __name)            \
+    static uint8_t                                                              \
+    SIMPLEBTN_CONNECT2(simpleButton_Private_GestureNext_, __name)               \
+        [(__maxStates) * (__maxClasses)];                                       \
+                                                                                \
+    static uint8_t                                                              \
+    SIMPLEBTN_CONNECT2(simpleButton_Private_GestureWork_, __name)               \
+        [5 * (__maxStates)];                                                    \
+                                                                                \
+    SimpleButton_Type_Gesture_t                                                 \
+    SIMPLEBTN_CONNECT2(SIMPLEBTN_NAMESPACE, __name);                            \
+                                                                                \
+    SIMPLEBTN_C_API void                                                        \
+    SIMPLEBTN_CONNECT3(SIMPLEBTN_NAMESPACE, __name, _Init)(                     \
+        const SimpleButton_Type_GesturePattern_t* const patterns,               \
+        uint8_t patternCount                                                    \
+    ) {                                                                         \
+        SimpleButton_Gesture_Init(                                              \
+            &(SIMPLEBTN_CONNECT2(SIMPLEBTN_NAMESPACE, __name)),                 \
+            SIMPLEBTN_CONNECT2(simpleButton_Private_GestureNext_, __name),      \
+            SIMPLEBTN_CONNECT2(simpleButton_Private_GestureWork_, __name),      \
+            (uint8_t)(__maxStates),                                             \
+            (uint8_t)(__maxClasses),                                            \
+            patterns,                                                           \
+            patternCount                                                        \
+        );                                                                      \
+    }
+
+/**
+ * @def         SIMPLEBTN__GESTURE_DECLARE
+ * @param[in]   __name - The name of recognizer.
+ */
+#define SIMPLEBTN__GESTURE_DECLARE(__name)                                      \
+    extern SimpleButton_Type_Gesture_t                                          \
+    SIMPLEBTN_CONNECT2(SIMPLEBTN_NAMESPACE, __name);                            \
+    SIMPLEBTN_C_API void                                                        \
+    SIMPLEBTN_CONNECT3(SIMPLEBTN_NAMESPACE, __name, _Init)(                     \
+        const SimpleButton_Type_GesturePattern_t* const patterns,               \
+        uint8_t patternCount                                                    \
+    );
+
+SIMPLEBTN_C_API void
+SimpleButton_Gesture_Init(
+    SimpleButton_Type_Gesture_t* const self,
+    uint8_t* const nextBuffer,
+    uint8_t* const workBuffer,
+    uint8_t maxStates,
+    uint8_t maxClasses,
+    const SimpleButton_Type_GesturePattern_t* const patterns,
+    uint8_t patternCount
+);
+
+SIMPLEBTN_C_API uint8_t
+SimpleButton_Gesture_Feed(
+    SimpleButton_Type_Gesture_t* const self,
+    uint8_t symbol
+);
+
+SIMPLEBTN_C_API uint8_t
+SimpleButton_Gesture_FeedRepeat(
+    SimpleButton_Type_Gesture_t* const self,
+    uint8_t button,
+    uint8_t repeatCount
+);
+
+SIMPLEBTN_C_API uint8_t
+SimpleButton_Gesture_Handler(
+    SimpleButton_Type_Gesture_t* const self
+);
+
+#endif /* SIMPLEBUTTON_GESTURE_H__ */
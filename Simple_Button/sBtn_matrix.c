@@ -0,0 +1,217 @@
+/**
+ * @file            sBtn_matrix.c
+ *
+ * @author          Kim-J-Smith
+ *
+ * @brief           Source file of the key-matrix scanning engine. This file
+ *                  contains functions for matrix-init, matrix-scan with
+ *                  ghost-key detection, and feeding the keys into the
+ *                  button state machine.
+ *
+ * @version         0.8.x
+ *
+ * @date            2025-10-03
+ *
+ * @attention       Copyright (c) 2025 Kim-J-Smith.
+ *                  All rights reserved.
+ *
+ * @copyright       SPDX-License-Identifier: MIT
+ *                  Refer to the LICENCE file in root for more details.
+ *                  <https://github.com/Kim-J-Smith/Simple-Button>
+ */
+#include    "sBtn_matrix.h"
+
+
+/* HOT : Trigger hotspot optimization */
+#if defined(__GNUC__) || defined(__clang__)
+ #define HOT_ __attribute__((hot))
+#elif defined(_MSC_VER) && ( _MSC_VER >= 1900 )
+ #define HOT_ __declspec(hot)
+#else
+ #define HOT_
+#endif /* HOT */
+
+/* The max number of rows (and columns) */
+#define SIMPLEBTN_MATRIX_MAX_                   32U
+
+/* a helper function : non-zero if more than one bit is set */
+SIMPLEBTN_FORCE_INLINE uint32_t
+simpleButton_Private_Matrix_IsMultiBit(const uint32_t x)
+{
+    return (x & (x - 1U));
+}
+
+/**
+ * @brief           Initialize the key-matrix.
+ *
+ * @param[inout]    self - The pointer of the matrix.
+ * @param[in]       keys - Storage of `rows * cols` keys.
+ * @param[in]       rowBuffer - Storage of `2 * rows` words.
+ * @param[in]       rows - The number of rows. (1 ~ 32)
+ * @param[in]       cols - The number of columns. (1 ~ 32)
+ * @param[in]       config - The hardware hooks and wiring. (copied)
+ *
+ * @return          None
+ */
+SIMPLEBTN_C_API void
+SimpleButton_Matrix_Init(
+    SimpleButton_Type_Matrix_t* const self,
+    simpleButton_Type_VirtualKey_t* const keys,
+    uint32_t* const rowBuffer,
+    uint8_t rows,
+    uint8_t cols,
+    const SimpleButton_Type_MatrixConfig_t* const config
+) {
+    uint16_t i;
+
+#if defined(SIMPLEBTN_DEBUG)
+    if (0 == self || 0 == keys || 0 == rowBuffer || 0 == config || 0 == config->selectRow
+        || 0 == config->readColumns || rows == 0 || cols == 0
+        || rows > SIMPLEBTN_MATRIX_MAX_ || cols > SIMPLEBTN_MATRIX_MAX_
+    ) {
+        SIMPLEBTN_FUNC_PANIC(
+            "invalid input in func:SimpleButton_Matrix_Init",
+            simpleButton_ErrorNum_invalidInput,
+        );
+    }
+#endif /* defined(SIMPLEBTN_DEBUG) */
+
+    SIMPLEBTN_FUNC_CRITICAL_SECTION_BEGIN(); /* critical section begin */
+
+    self->keys = keys;
+    self->rowState = rowBuffer;
+    self->rowActive = rowBuffer + rows;
+    self->config = *config;
+    self->callBacks.shortPushCallBack = 0;
+    self->callBacks.longPushCallBack = 0;
+    self->callBacks.repeatPushCallBack = 0;
+    self->columnMask = (cols >= SIMPLEBTN_MATRIX_MAX_) ? 0xFFFFFFFFU : ((1U << cols) - 1U);
+    self->ghostCount = 0;
+    self->currentKey = 0;
+    self->rows = rows;
+    self->cols = cols;
+
+    for (i = 0; i < rows; i++) {
+        self->rowState[i] = 0;
+        self->rowActive[i] = 0;
+    }
+
+    for (i = 0; i < (uint16_t)rows * cols; i++) {
+        simpleButton_Private_InitStructPrivate(&(keys[i].Private));
+        simpleButton_Private_InitStructPublic(&(keys[i].Public));
+    }
+
+    SIMPLEBTN_FUNC_CRITICAL_SECTION_END(); /* critical section end */
+}
+
+/**
+ * @brief           Scan the whole matrix and handle the keys.
+ *
+ * @param[inout]    self - The pointer of the matrix.
+ *
+ * @return          None
+ *
+ * @note            Cost : `rows` x (select + one column read + unselect),
+ *                  plus the state machine of the keys which are pushed or not
+ *                  idle. Idle keys are skipped with bit operations only.
+ *
+ *                  Without diodes, two rows sharing two pushed columns are
+ *                  ambiguous (one of the four keys may be a ghost). These rows
+ *                  keep their previous state until the pattern is gone, so
+ *                  the real keys still get N-key rollover.
+ */
+SIMPLEBTN_C_API HOT_ void
+SimpleButton_Matrix_Handler(
+    SimpleButton_Type_Matrix_t* const self
+) {
+    uint32_t sample[SIMPLEBTN_MATRIX_MAX_];
+    uint32_t ghostRows = 0;
+    uint8_t row;
+
+    /* 1. sample every row with one whole-port read */
+    for (row = 0; row < self->rows; row++) {
+        self->config.selectRow(row);
+        sample[row] = (self->config.readColumns() ^ self->config.columnInvert) & self->columnMask;
+        if (self->config.unselectRow != 0) {
+            self->config.unselectRow(row);
+        }
+    }
+
+    /* 2. find the ghost-key patterns (only rows with 2+ keys can take part) */
+    if (!self->config.hasDiodes) {
+        for (row = 0; row < self->rows; row++) {
+            uint8_t other;
+
+            if (!simpleButton_Private_Matrix_IsMultiBit(sample[row])) {
+                continue;
+            }
+
+            for (other = (uint8_t)(row + 1); other < self->rows; other++) {
+                if (simpleButton_Private_Matrix_IsMultiBit(sample[row] & sample[other])) {
+                    ghostRows |= (1UL << row) | (1UL << other);
+                }
+            }
+        }
+
+        if (ghostRows != 0) {
+            self->ghostCount ++;
+        }
+    }
+
+    /* 3. feed the pushed and the busy keys into the state machine */
+    for (row = 0; row < self->rows; row++) {
+        const uint16_t firstKey = (uint16_t)((uint16_t)row * self->cols);
+
+        if ((ghostRows & (1UL << row)) == 0) {
+            self->rowState[row] = sample[row];
+        }
+
+        self->rowActive[row] = simpleButton_Private_ScanWord(
+            &(self->keys[firstKey]),
+            self->rowState[row],
+            self->rowActive[row],
+            &(self->callBacks),
+            &(self->currentKey),
+            firstKey
+        );
+    }
+}
+
+/**
+ * @brief           Get the `Public` config of a key, to change its adjustable time,
+ *                  pressed/released events, ...
+ *
+ * @return          The pointer of `Public`, or 0 if the key does not exist.
+ */
+SIMPLEBTN_C_API simpleButton_Type_PublicBtnStatus_t*
+SimpleButton_Matrix_GetKeyPublic(
+    SimpleButton_Type_Matrix_t* const self,
+    uint8_t row,
+    uint8_t col
+) {
+    if (row >= self->rows || col >= self->cols) {
+        return 0;
+    }
+
+    return &(self->keys[(uint16_t)row * self->cols + col].Public);
+}
+
+/**
+ * @brief           Check whether all the keys of the matrix are idle.
+ *
+ * @return          Non-zero if all of them are in `Wait_For_Interrupt` state.
+ */
+SIMPLEBTN_C_API uint32_t
+SimpleButton_Matrix_AllIdle(
+    SimpleButton_Type_Matrix_t* const self
+) {
+    uint8_t row;
+
+    for (row = 0; row < self->rows; row++) {
+        if (self->rowActive[row] != 0 || self->rowState[row] != 0) {
+            return 0;
+        }
+    }
+
+    return 1;
+}
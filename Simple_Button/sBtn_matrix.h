@@ -0,0 +1,189 @@
+/**
+ * @file            sBtn_matrix.h
+ *
+ * @author          Kim-J-Smith
+ *
+ * @brief           Header file of the key-matrix scanning engine. A matrix of
+ *                  up to 32 x 32 keys is scanned row by row, one whole-port
+ *                  column read for each row, and every key is fed into the
+ *                  button state machine (short/long/repeat/hold push).
+ *
+ * @version         0.8.x
+ *
+ * @date            2025-10-03
+ *
+ * @attention       Copyright (c) 2025 Kim-J-Smith.
+ *                  All rights reserved.
+ *
+ * @copyright       SPDX-License-Identifier: MIT
+ *                  Refer to the LICENCE file in root for more details.
+ *                  <https://github.com/Kim-J-Smith/Simple-Button>
+ */
+#ifndef     SIMPLEBUTTON_MATRIX_H__
+#define     SIMPLEBUTTON_MATRIX_H__     1020L
+
+#include    "Simple_Button.h"
+#if ( SIMPLEBUTTON_MATRIX_H__ != SIMPLEBUTTON_H__ )
+ #warning [Simple-Button] : the version of "sBtn_matrix.h"\
+ is different from it of "Simple_Button.h".
+#endif /* SIMPLEBUTTON_MATRIX_H__ != SIMPLEBUTTON_H__ */
+
+/* Drive the row to its active level (and the other rows inactive). */
+typedef void (* SimpleButton_Type_MatrixSelectRow_t)(uint8_t row);
+
+/* Release the row. (can be 0 if `selectRow` already drives all rows) */
+typedef void (* SimpleButton_Type_MatrixUnselectRow_t)(uint8_t row);
+
+/* Read all the columns at once. Bit N is column N. */
+typedef uint32_t (* SimpleButton_Type_MatrixReadColumns_t)(void);
+
+/**
+ * @struct      SimpleButton_Type_MatrixConfig_t
+ *
+ * @brief       The hardware hooks and wiring of a key-matrix.
+ */
+typedef struct SimpleButton_Type_MatrixConfig_t {
+
+    SimpleButton_Type_MatrixSelectRow_t     selectRow;
+
+    SimpleButton_Type_MatrixUnselectRow_t   unselectRow;
+
+    SimpleButton_Type_MatrixReadColumns_t   readColumns;
+
+    uint32_t    columnInvert;   /* columns whose pushed level is 0 (usually all of them) */
+
+    uint8_t     hasDiodes;      /* every key has a diode, no ghost-key can appear */
+
+} SimpleButton_Type_MatrixConfig_t;
+
+/**
+ * @struct      SimpleButton_Type_Matrix_t
+ *
+ * @brief       The key-matrix object.
+ *
+ * @note        Key (row, col) is `keys[row * cols + col]`.
+ */
+typedef struct SimpleButton_Type_Matrix_t {
+
+    simpleButton_Type_VirtualKey_t* keys;
+
+    uint32_t*                       rowState; /* pushed keys of each row (ghost free) */
+
+    uint32_t*                       rowActive; /* keys which are not idle */
+
+    SimpleButton_Type_MatrixConfig_t config;
+
+    simpleButton_Type_CallBackSet_t callBacks;
+
+    uint32_t                        columnMask;
+
+    uint32_t                        ghostCount; /* scans with a ghost-key pattern */
+
+    volatile uint16_t               currentKey; /* the key whose callback is running */
+
+    uint8_t                         rows;
+
+    uint8_t                         cols;
+
+} SimpleButton_Type_Matrix_t;
+
+/**
+ * @def         SIMPLEBTN__MATRIX_CREATE
+ * @brief       Create a key-matrix with static storage.
+ * @param[in]   __rows - The number of rows. (1 ~ 32)
+ * @param[in]   __cols - The number of columns. (1 ~ 32)
+ * @param[in]   __name - The name of the matrix.
+ * @note        Initialize it with `prefix/namespace` + `__name` + `_Init(&config)`.
+ */
+#define SIMPLEBTN__MATRIX_CREATE(__rows, __cols, __name)                        \
+    static simpleButton_Type_VirtualKey_t                                       \
+    SIMPLEBTN_CONNECT2(simpleButton_Private_MatrixKeys_, __name)[(__rows) * (__cols)]; \
+                                                                                \
+    static uint32_t                                                             \
+    SIMPLEBTN_CONNECT2(simpleButton_Private_MatrixRows_, __name)[2 * (__rows)]; \
+                                                                                \
+    SimpleButton_Type_Matrix_t                                                  \
+    SIMPLEBTN_CONNECT2(SIMPLEBTN_NAMESPACE, __name);                            \
+                                                                                \
+    SIMPLEBTN_C_API void                                                        \
+    SIMPLEBTN_CONNECT3(SIMPLEBTN_NAMESPACE, __name, _Init)(                     \
+        const SimpleButton_Type_MatrixConfig_t* const config                    \
+    ) {                                                                         \
+        SimpleButton_Matrix_Init(                                               \
+            &(SIMPLEBTN_CONNECT2(SIMPLEBTN_NAMESPACE, __name)),                 \
+            SIMPLEBTN_CONNECT2(simpleButton_Private_MatrixKeys_, __name),       \
+            SIMPLEBTN_CONNECT2(simpleButton_Private_MatrixRows_, __name),       \
+            (uint8_t)(__rows),                                                  \
+            (uint8_t)(__cols),                                                  \
+            config                                                              \
+        );                                                                      \
+    }
+
+/**
+ * @def         SIMPLEBTN__MATRIX_DECLARE
+ * @param[in]   __name - The name of matrix.
+ */
+#define SIMPLEBTN__MATRIX_DECLARE(__name)                                       \
+    extern SimpleButton_Type_Matrix_t                                           \
+    SIMPLEBTN_CONNECT2(SIMPLEBTN_NAMESPACE, __name);                            \
+    SIMPLEBTN_C_API void                                                        \
+    SIMPLEBTN_CONNECT3(SIMPLEBTN_NAMESPACE, __name, _Init)(                     \
+        const SimpleButton_Type_MatrixConfig_t* const config                    \
+    );
+
+/**
+ * @def             SIMPLEBTN__MATRIX_SETCALLBACK
+ * @brief           Set the callback functions shared by all the keys of a matrix.
+ *                  Use `SimpleButton_Matrix_CurrentKey()` in them to get the key.
+ */
+#define SIMPLEBTN__MATRIX_SETCALLBACK(matrix, shortCB, longCB, repeatCB)                \
+    do {                                                                                \
+        (matrix).callBacks.shortPushCallBack = shortCB;                                 \
+        (matrix).callBacks.longPushCallBack = longCB;                                   \
+        (matrix).callBacks.repeatPushCallBack = repeatCB;                               \
+    } while(0)
+
+SIMPLEBTN_C_API void
+SimpleButton_Matrix_Init(
+    SimpleButton_Type_Matrix_t* const self,
+    simpleButton_Type_VirtualKey_t* const keys,
+    uint32_t* const rowBuffer,
+    uint8_t rows,
+    uint8_t cols,
+    const SimpleButton_Type_MatrixConfig_t* const config
+);
+
+SIMPLEBTN_C_API void
+SimpleButton_Matrix_Handler(
+    SimpleButton_Type_Matrix_t* const self
+);
+
+SIMPLEBTN_C_API simpleButton_Type_PublicBtnStatus_t*
+SimpleButton_Matrix_GetKeyPublic(
+    SimpleButton_Type_Matrix_t* const self,
+    uint8_t row,
+    uint8_t col
+);
+
+SIMPLEBTN_C_API uint32_t
+SimpleButton_Matrix_AllIdle(
+    SimpleButton_Type_Matrix_t* const self
+);
+
+/**
+ * @brief   Get the key whose callback function is running.
+ * @return  The index of the key, `row * cols + col`.
+ */
+SIMPLEBTN_FORCE_INLINE uint16_t
+SimpleButton_Matrix_CurrentKey(
+    const SimpleButton_Type_Matrix_t* const self
+) {
+#if SIMPLEBTN_MODE_ENABLE_DEFERRED_CALLBACK != 0
+    (void)self;
+    return SimpleButton_Deferred_CurrentKey(); /* the scanner may be on another key */
+#else
+    return self->currentKey;
+#endif /* SIMPLEBTN_MODE_ENABLE_DEFERRED_CALLBACK != 0 */
+}
+
+#endif /* SIMPLEBUTTON_MATRIX_H__ */
@@ -0,0 +1,317 @@
+/**
+ * @file            sBtn_pool.c
+ *
+ * @author          Kim-J-Smith
+ *
+ * @brief           Source file of the dynamic-button pool. This file contains
+ *                  functions to create, destroy and handle the dynamic-buttons
+ *                  kept in a pool.
+ *
+ * @version         0.8.x
+ *
+ * @date            2025-10-03
+ *
+ * @attention       Copyright (c) 2025 Kim-J-Smith.
+ *                  All rights reserved.
+ *
+ * @copyright       SPDX-License-Identifier: MIT
+ *                  Refer to the LICENCE file in root for more details.
+ *                  <https://github.com/Kim-J-Smith/Simple-Button>
+ */
+#include    "sBtn_pool.h"
+
+
+/* HOT : Trigger hotspot optimization */
+#if defined(__GNUC__) || defined(__clang__)
+ #define HOT_ __attribute__((hot))
+#elif defined(_MSC_VER) && ( _MSC_VER >= 1900 )
+ #define HOT_ __declspec(hot)
+#else
+ #define HOT_ 
+#endif /* HOT */
+
+/* a helper function : swap two slots and keep the handle map in step */
+SIMPLEBTN_FORCE_INLINE void
+simpleButton_Private_Pool_Swap(
+    SimpleButton_Type_DynamicBtnPool_t* const pool,
+    const uint16_t slot_a,
+    const uint16_t slot_b
+) {
+    simpleButton_Type_PoolEntry_t temp;
+
+    if (slot_a == slot_b) {
+        return;
+    }
+
+    temp = pool->entries[slot_a];
+    pool->entries[slot_a] = pool->entries[slot_b];
+    pool->entries[slot_b] = temp;
+
+    pool->slotOfHandle[pool->entries[slot_a].handle] = slot_a;
+    pool->slotOfHandle[pool->entries[slot_b].handle] = slot_b;
+}
+
+/* a helper function : move the dead buttons out of the live range */
+static void
+simpleButton_Private_Pool_Compact(
+    SimpleButton_Type_DynamicBtnPool_t* const pool
+) {
+    uint16_t slot = 0;
+
+    while (slot < pool->count) {
+        if (pool->entries[slot].is_dead) {
+            pool->count --;
+            simpleButton_Private_Pool_Swap(pool, slot, pool->count);
+            pool->entries[pool->count].is_dead = 0;
+        } else {
+            slot ++;
+        }
+    }
+
+    pool->has_dead = 0;
+}
+
+/**
+ * @brief           Initialize the pool. All the buttons in it are dropped.
+ *
+ * @param[inout]    pool - The pointer of the pool.
+ * @param[in]       entries - Storage of `capacity` slots.
+ * @param[in]       slotOfHandle - Storage of `capacity` handle map entries.
+ * @param[in]       capacity - The max number of live buttons. (1 ~ 65534)
+ *
+ * @return          None
+ */
+SIMPLEBTN_C_API void
+SimpleButton_DynamicPool_Init(
+    SimpleButton_Type_DynamicBtnPool_t* const pool,
+    simpleButton_Type_PoolEntry_t* const entries,
+    uint16_t* const slotOfHandle,
+    uint16_t capacity
+) {
+    uint16_t i;
+
+#if defined(SIMPLEBTN_DEBUG)
+    if (0 == pool || 0 == entries || 0 == slotOfHandle || capacity == SIMPLEBTN_POOL_INVALID_HANDLE) {
+        SIMPLEBTN_FUNC_PANIC(
+            "invalid input in func:SimpleButton_DynamicPool_Init",
+            simpleButton_ErrorNum_invalidInput,
+        );
+    }
+#endif /* defined(SIMPLEBTN_DEBUG) */
+
+    SIMPLEBTN_FUNC_CRITICAL_SECTION_BEGIN(); /* critical section begin */
+
+    pool->entries = entries;
+    pool->slotOfHandle = slotOfHandle;
+    pool->capacity = capacity;
+    pool->count = 0;
+    pool->is_busy = 0;
+    pool->has_dead = 0;
+
+    for (i = 0; i < capacity; i++) {
+        entries[i].handle = i;
+        entries[i].is_dead = 0;
+        slotOfHandle[i] = i;
+    }
+
+    SIMPLEBTN_FUNC_CRITICAL_SECTION_END(); /* critical section end */
+}
+
+/**
+ * @brief           Create a dynamic-button in the pool.
+ *
+ * @param[inout]    pool - The pointer of the pool.
+ * @param[in]       GPIO_Base - The base address of the GPIO port
+ *                  connected to the button.
+ * @param[in]       GPIO_Pin - The GPIO Pin number connected to the button.
+ * @param[in]       inactiveLevel - GPIO Pin level that didn't be pressed. (can be 1 or 0)
+ * @param[in]       shortPushCallBack - callback function for short push.
+ * @param[in]       longPushCallBack - callback function for long push.
+ * @param[in]       repeatPushCallBack - callback function for repeat push.
+ *
+ * @return          The handle of the button, or `SIMPLEBTN_POOL_INVALID_HANDLE`
+ *                  if the pool is full.
+ */
+SIMPLEBTN_C_API SimpleButton_Type_PoolHandle_t
+SimpleButton_DynamicPool_Create(
+    SimpleButton_Type_DynamicBtnPool_t* const pool,
+    simpleButton_Type_GPIOBase_t    GPIO_Base,
+    simpleButton_Type_GPIOPin_t     GPIO_Pin,
+    simpleButton_Type_GPIOPinVal_t  inactiveLevel,
+    simpleButton_Type_ShortPushCallBack_t shortPushCallBack,
+    simpleButton_Type_LongPushCallBack_t longPushCallBack,
+    simpleButton_Type_RepeatPushCallBack_t repeatPushCallBack
+) {
+    simpleButton_Type_PoolEntry_t* entry;
+    SimpleButton_Type_PoolHandle_t handle;
+
+    SIMPLEBTN_FUNC_CRITICAL_SECTION_BEGIN(); /* critical section begin */
+
+    if (pool->count >= pool->capacity) {
+        SIMPLEBTN_FUNC_CRITICAL_SECTION_END(); /* critical section end */
+        return SIMPLEBTN_POOL_INVALID_HANDLE; /* the pool is full */
+    }
+
+    /* the first free slot already holds a free handle */
+    entry = &(pool->entries[pool->count]);
+    handle = entry->handle;
+
+    entry->button.GPIO_Base = GPIO_Base;
+    entry->button.GPIO_Pin = GPIO_Pin;
+    entry->button.normalPinVal = inactiveLevel;
+    simpleButton_Private_InitStructPrivate(&(entry->button.Private));
+    simpleButton_Private_InitStructPublic(&(entry->button.Public));
+
+#if SIMPLEBTN_MODE_ENABLE_ADAPTIVE_POLLING != 0
+    entry->button.nextPollTick = SIMPLEBTN_FUNC_GET_TICK(); /* poll it at once, not at the tick of a dead button */
+#endif /* SIMPLEBTN_MODE_ENABLE_ADAPTIVE_POLLING != 0 */
+
+    entry->callBacks.shortPushCallBack = shortPushCallBack;
+    entry->callBacks.longPushCallBack = longPushCallBack;
+    entry->callBacks.repeatPushCallBack = repeatPushCallBack;
+    entry->is_dead = 0;
+
+    pool->count ++;
+
+    SIMPLEBTN_FUNC_CRITICAL_SECTION_END(); /* critical section end */
+
+    return handle;
+}
+
+/**
+ * @brief           Destroy a dynamic-button in the pool.
+ *
+ * @param[inout]    pool - The pointer of the pool.
+ * @param[in]       handle - The handle returned by `SimpleButton_DynamicPool_Create()`.
+ *
+ * @return          None
+ *
+ * @note            The last button is moved into the hole, so the live buttons
+ *                  stay contiguous. When called from a callback inside
+ *                  `SimpleButton_DynamicPool_HandleAll()`, the button is only
+ *                  marked and the move is done after the handling.
+ */
+SIMPLEBTN_C_API void
+SimpleButton_DynamicPool_Destroy(
+    SimpleButton_Type_DynamicBtnPool_t* const pool,
+    SimpleButton_Type_PoolHandle_t handle
+) {
+    uint16_t slot;
+
+    SIMPLEBTN_FUNC_CRITICAL_SECTION_BEGIN(); /* critical section begin */
+
+    if (handle >= pool->capacity) {
+        SIMPLEBTN_FUNC_CRITICAL_SECTION_END(); /* critical section end */
+        return; /* invalid handle */
+    }
+
+    slot = pool->slotOfHandle[handle];
+    if (slot >= pool->count || pool->entries[slot].is_dead) {
+        SIMPLEBTN_FUNC_CRITICAL_SECTION_END(); /* critical section end */
+        return; /* not alive */
+    }
+
+    if (pool->is_busy) {
+        pool->entries[slot].is_dead = 1;
+        pool->has_dead = 1;
+    } else {
+        pool->count --;
+        simpleButton_Private_Pool_Swap(pool, slot, pool->count);
+    }
+
+    SIMPLEBTN_FUNC_CRITICAL_SECTION_END(); /* critical section end */
+}
+
+/**
+ * @brief           Get the dynamic-button object, to change its `Public` config.
+ *
+ * @param[inout]    pool - The pointer of the pool.
+ * @param[in]       handle - The handle returned by `SimpleButton_DynamicPool_Create()`.
+ *
+ * @return          The pointer of the button, or 0 if the handle is not alive.
+ *
+ * @attention       The pointer is only valid until the next destroy in the pool.
+ */
+SIMPLEBTN_C_API SimpleButton_Type_DynamicBtn_t*
+SimpleButton_DynamicPool_Get(
+    SimpleButton_Type_DynamicBtnPool_t* const pool,
+    SimpleButton_Type_PoolHandle_t handle
+) {
+    uint16_t slot;
+
+    if (handle >= pool->capacity) {
+        return 0;
+    }
+
+    slot = pool->slotOfHandle[handle];
+    if (slot >= pool->count || pool->entries[slot].is_dead) {
+        return 0;
+    }
+
+    return &(pool->entries[slot].button);
+}
+
+/**
+ * @brief           Handle all the live buttons in the pool.
+ *
+ * @param[inout]    pool - The pointer of the pool.
+ *
+ * @return          None
+ */
+SIMPLEBTN_C_API HOT_ void
+SimpleButton_DynamicPool_HandleAll(
+    SimpleButton_Type_DynamicBtnPool_t* const pool
+) {
+    uint16_t slot;
+
+    pool->is_busy = 1;
+
+    /* `count` is read every time, the callback may create new buttons */
+    for (slot = 0; slot < pool->count; slot++) {
+        simpleButton_Type_PoolEntry_t* const entry = &(pool->entries[slot]);
+
+        if (entry->is_dead) {
+            continue;
+        }
+
+        SimpleButton_DynamicButton_Handler(
+            &(entry->button),
+            entry->callBacks.shortPushCallBack,
+            entry->callBacks.longPushCallBack,
+            entry->callBacks.repeatPushCallBack
+        );
+    }
+
+    SIMPLEBTN_FUNC_CRITICAL_SECTION_BEGIN(); /* critical section begin */
+
+    if (pool->has_dead) {
+        simpleButton_Private_Pool_Compact(pool);
+    }
+    pool->is_busy = 0;
+
+    SIMPLEBTN_FUNC_CRITICAL_SECTION_END(); /* critical section end */
+}
+
+/**
+ * @brief           Check whether all the live buttons in the pool are idle.
+ *
+ * @param[inout]    pool - The pointer of the pool.
+ *
+ * @return          Non-zero if all of them are in `Wait_For_Interrupt` state.
+ */
+SIMPLEBTN_C_API uint32_t
+SimpleButton_DynamicPool_AllIdle(
+    SimpleButton_Type_DynamicBtnPool_t* const pool
+) {
+    uint16_t slot;
+
+    for (slot = 0; slot < pool->count; slot++) {
+        if ((simpleButton_Type_ButtonState_t)(pool->entries[slot].button.Private.state)
+            != simpleButton_State_Wait_For_Interrupt
+        ) {
+            return 0;
+        }
+    }
+
+    return 1;
+}
@@ -0,0 +1,153 @@
+/**
+ * @file            sBtn_pool.h
+ *
+ * @author          Kim-J-Smith
+ *
+ * @brief           Header file of the dynamic-button pool. The pool keeps
+ *                  the dynamic-buttons created at runtime in a fixed-size
+ *                  contiguous array, without any memory allocation.
+ *
+ * @version         0.8.x
+ *
+ * @date            2025-10-03
+ *
+ * @attention       Copyright (c) 2025 Kim-J-Smith.
+ *                  All rights reserved.
+ *
+ * @copyright       SPDX-License-Identifier: MIT
+ *                  Refer to the LICENCE file in root for more details.
+ *                  <https://github.com/Kim-J-Smith/Simple-Button>
+ */
+#ifndef     SIMPLEBUTTON_POOL_H__
+#define     SIMPLEBUTTON_POOL_H__   1020L
+
+#include    "Simple_Button.h"
+#if ( SIMPLEBUTTON_POOL_H__ != SIMPLEBUTTON_H__ )
+ #warning [Simple-Button] : the version of "sBtn_pool.h"\
+ is different from it of "Simple_Button.h".
+#endif /* SIMPLEBUTTON_POOL_H__ != SIMPLEBUTTON_H__ */
+
+/* The handle returned when the pool is full */
+#define SIMPLEBTN_POOL_INVALID_HANDLE           0xFFFFU
+
+/* Handle of a button in the pool. It stays valid until the button is destroyed. */
+typedef uint16_t            SimpleButton_Type_PoolHandle_t;
+
+/* One slot of the pool. (internal use) */
+typedef struct simpleButton_Type_PoolEntry_t {
+
+    SimpleButton_Type_DynamicBtn_t  button;
+
+    simpleButton_Type_CallBackSet_t callBacks;
+
+    SimpleButton_Type_PoolHandle_t  handle;
+
+    volatile uint8_t                is_dead; /* destroyed while handling */
+
+} simpleButton_Type_PoolEntry_t;
+
+/**
+ * @struct      SimpleButton_Type_DynamicBtnPool_t
+ *
+ * @brief       The pool of dynamic-buttons.
+ *
+ * @note        The live buttons always occupy `entries[0, count)`.
+ *              `entries[i].handle` is a permutation of all the handles,
+ *              and `slotOfHandle[]` is its inverse, so create/destroy
+ *              are O(1) and destroy fills the hole with the last button.
+ */
+typedef struct SimpleButton_Type_DynamicBtnPool_t {
+
+    simpleButton_Type_PoolEntry_t*  entries;
+
+    uint16_t*                       slotOfHandle;
+
+    uint16_t                        capacity;
+
+    volatile uint16_t               count;
+
+    volatile uint8_t                is_busy; /* HandleAll() is running */
+
+    volatile uint8_t                has_dead;
+
+} SimpleButton_Type_DynamicBtnPool_t;
+
+/**
+ * @def         SIMPLEBTN__DYNPOOL_CREATE
+ * @brief       Create a pool of dynamic-buttons with static storage.
+ * @param[in]   __capacity - The max number of live buttons. (1 ~ 65534)
+ * @param[in]   __name - The name of the pool.
+ * @note        Initialize it with `prefix/namespace` + `__name` + `_Init()`.
+ */
+#define SIMPLEBTN__DYNPOOL_CREATE(__capacity, __name)                           \
+    static simpleButton_Type_PoolEntry_t                                        \
+    SIMPLEBTN_CONNECT2(simpleButton_Private_PoolEntries_, __name)[__capacity];  \
+                                                                                \
+    static uint16_t                                                             \
+    SIMPLEBTN_CONNECT2(simpleButton_Private_PoolSlots_, __name)[__capacity];    \
+                                                                                \
+    SimpleButton_Type_DynamicBtnPool_t                                          \
+    SIMPLEBTN_CONNECT2(SIMPLEBTN_NAMESPACE, __name);                            \
+                                                                                \
+    SIMPLEBTN_C_API void                                                        \
+    SIMPLEBTN_CONNECT3(SIMPLEBTN_NAMESPACE, __name, _Init)(void) {              \
+        SimpleButton_DynamicPool_Init(                                          \
+            &(SIMPLEBTN_CONNECT2(SIMPLEBTN_NAMESPACE, __name)),                 \
+            SIMPLEBTN_CONNECT2(simpleButton_Private_PoolEntries_, __name),      \
+            SIMPLEBTN_CONNECT2(simpleButton_Private_PoolSlots_, __name),        \
+            (uint16_t)(__capacity)                                              \
+        );                                                                      \
+    }
+
+/**
+ * @def         SIMPLEBTN__DYNPOOL_DECLARE
+ * @param[in]   __name - The name of pool.
+ */
+#define SIMPLEBTN__DYNPOOL_DECLARE(__name)                                      \
+    extern SimpleButton_Type_DynamicBtnPool_t                                   \
+    SIMPLEBTN_CONNECT2(SIMPLEBTN_NAMESPACE, __name);                            \
+    SIMPLEBTN_C_API void                                                        \
+    SIMPLEBTN_CONNECT3(SIMPLEBTN_NAMESPACE, __name, _Init)(void);
+
+SIMPLEBTN_C_API void
+SimpleButton_DynamicPool_Init(
+    SimpleButton_Type_DynamicBtnPool_t* const pool,
+    simpleButton_Type_PoolEntry_t* const entries,
+    uint16_t* const slotOfHandle,
+    uint16_t capacity
+);
+
+SIMPLEBTN_C_API SimpleButton_Type_PoolHandle_t
+SimpleButton_DynamicPool_Create(
+    SimpleButton_Type_DynamicBtnPool_t* const pool,
+    simpleButton_Type_GPIOBase_t    GPIO_Base,
+    simpleButton_Type_GPIOPin_t     GPIO_Pin,
+    simpleButton_Type_GPIOPinVal_t  inactiveLevel,
+    simpleButton_Type_ShortPushCallBack_t shortPushCallBack,
+    simpleButton_Type_LongPushCallBack_t longPushCallBack,
+    simpleButton_Type_RepeatPushCallBack_t repeatPushCallBack
+);
+
+SIMPLEBTN_C_API void
+SimpleButton_DynamicPool_Destroy(
+    SimpleButton_Type_DynamicBtnPool_t* const pool,
+    SimpleButton_Type_PoolHandle_t handle
+);
+
+SIMPLEBTN_C_API SimpleButton_Type_DynamicBtn_t*
+SimpleButton_DynamicPool_Get(
+    SimpleButton_Type_DynamicBtnPool_t* const pool,
+    SimpleButton_Type_PoolHandle_t handle
+);
+
+SIMPLEBTN_C_API void
+SimpleButton_DynamicPool_HandleAll(
+    SimpleButton_Type_DynamicBtnPool_t* const pool
+);
+
+SIMPLEBTN_C_API uint32_t
+SimpleButton_DynamicPool_AllIdle(
+    SimpleButton_Type_DynamicBtnPool_t* const pool
+);
+
+#endif /* SIMPLEBUTTON_POOL_H__ */
@@ -0,0 +1,87 @@
+/**
+ * @file            sBtn_shiftreg.c
+ *
+ * @author          Kim-J-Smith
+ *
+ * @brief           Source file of the shift-register input source. This file
+ *                  contains the sampler which reads the whole chain into the
+ *                  bitmap of `sBtn_source.h`.
+ *
+ * @version         0.8.x
+ *
+ * @date            2025-10-03
+ *
+ * @attention       Copyright (c) 2025 Kim-J-Smith.
+ *                  All rights reserved.
+ *
+ * @copyright       SPDX-License-Identifier: MIT
+ *                  Refer to the LICENCE file in root for more details.
+ *                  <https://github.com/Kim-J-Smith/Simple-Button>
+ */
+#include    "sBtn_shiftreg.h"
+
+
+/* HOT : Trigger hotspot optimization */
+#if defined(__GNUC__) || defined(__clang__)
+ #define HOT_ __attribute__((hot))
+#elif defined(_MSC_VER) && ( _MSC_VER >= 1900 )
+ #define HOT_ __declspec(hot)
+#else
+ #define HOT_
+#endif /* HOT */
+
+/* a helper function : reverse the bits of a byte (MSB first -> input order) */
+SIMPLEBTN_FORCE_INLINE uint32_t
+simpleButton_Private_ShiftReg_Reverse(uint8_t x)
+{
+    x = (uint8_t)(((x & 0xF0U) >> 4) | ((x & 0x0FU) << 4));
+    x = (uint8_t)(((x & 0xCCU) >> 2) | ((x & 0x33U) << 2));
+    x = (uint8_t)(((x & 0xAAU) >> 1) | ((x & 0x55U) << 1));
+    return x;
+}
+
+/**
+ * @brief           The sampler of a 74HC165 chain. Load once, then one SPI
+ *                  burst (or `inputCount` bit-bang clocks) for the whole chain.
+ *
+ * @param[in]       context - The pointer of a `SimpleButton_Type_ShiftRegChain_t`.
+ * @param[out]      bitmap - Bit N is set if input N is pushed.
+ * @param[in]       inputCount - The number of bits in the chain.
+ *
+ * @return          None
+ */
+SIMPLEBTN_C_API HOT_ void
+SimpleButton_Source_SampleShiftReg(
+    void* context,
+    uint32_t* bitmap,
+    uint16_t inputCount
+) {
+    const SimpleButton_Type_ShiftRegChain_t* const chain = (const SimpleButton_Type_ShiftRegChain_t*)context;
+    const uint8_t flip = chain->activeLow ? 0xFFU : 0x00U;
+    uint16_t i;
+
+    chain->load();
+
+    if (chain->burst != 0) {
+        const uint16_t bytes = (uint16_t)((inputCount + 7U) / 8U);
+
+        chain->burst(chain->buffer, bytes);
+
+        for (i = 0; i < bytes; i++) {
+            bitmap[i >> 2] |= simpleButton_Private_ShiftReg_Reverse((uint8_t)(chain->buffer[i] ^ flip))
+                << ((i & 3U) * 8U);
+        }
+
+        /* the bits past the chain (unpopulated tail of the last byte) are not inputs */
+        if ((inputCount & 31U) != 0) {
+            bitmap[(inputCount - 1U) >> 5] &= (1UL << (inputCount & 31U)) - 1U;
+        }
+    } else {
+        for (i = 0; i < inputCount; i++) {
+            if ((chain->readData() ^ flip) & 1U) {
+                bitmap[i >> 5] |= (1UL << (i & 31U));
+            }
+            chain->clock();
+        }
+    }
+}
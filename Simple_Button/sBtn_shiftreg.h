@@ -0,0 +1,75 @@
+/**
+ * @file            sBtn_shiftreg.h
+ *
+ * @author          Kim-J-Smith
+ *
+ * @brief           Header file of the shift-register input source. A chain
+ *                  of parallel-in/serial-out registers (74HC165) is loaded
+ *                  and clocked out once per scan, by bit-bang or by an SPI
+ *                  burst, and every bit is an input of `sBtn_source.h`.
+ *
+ * @version         0.8.x
+ *
+ * @date            2025-10-03
+ *
+ * @attention       Copyright (c) 2025 Kim-J-Smith.
+ *                  All rights reserved.
+ *
+ * @copyright       SPDX-License-Identifier: MIT
+ *                  Refer to the LICENCE file in root for more details.
+ *                  <https://github.com/Kim-J-Smith/Simple-Button>
+ */
+#ifndef     SIMPLEBUTTON_SHIFTREG_H__
+#define     SIMPLEBUTTON_SHIFTREG_H__   1020L
+
+#include    "sBtn_source.h"
+#if ( SIMPLEBUTTON_SHIFTREG_H__ != SIMPLEBUTTON_H__ )
+ #warning [Simple-Button] : the version of "sBtn_shiftreg.h"\
+ is different from it of "Simple_Button.h".
+#endif /* SIMPLEBUTTON_SHIFTREG_H__ != SIMPLEBUTTON_H__ */
+
+/* Latch the parallel inputs of the whole chain (pulse /PL). */
+typedef void (* SimpleButton_Type_ShiftRegLoad_t)(void);
+
+/* Read `bytes` bytes from the chain, MSB first (SPI burst). */
+typedef void (* SimpleButton_Type_ShiftRegBurst_t)(uint8_t* buffer, uint16_t bytes);
+
+/* Bit-bang : read the serial output (Q7) of the chain. */
+typedef uint8_t (* SimpleButton_Type_ShiftRegReadData_t)(void);
+
+/* Bit-bang : pulse the clock (CP) once. */
+typedef void (* SimpleButton_Type_ShiftRegClock_t)(void);
+
+/**
+ * @struct      SimpleButton_Type_ShiftRegChain_t
+ *
+ * @brief       The context of `SimpleButton_Source_SampleShiftReg`.
+ *
+ * @note        Input N is the N-th bit clocked out after the load, that is
+ *              D7 ~ D0 of the register next to the MCU are the inputs 0 ~ 7.
+ *              Set `burst` to use SPI, or `readData` + `clock` to bit-bang.
+ */
+typedef struct SimpleButton_Type_ShiftRegChain_t {
+
+    SimpleButton_Type_ShiftRegLoad_t        load;
+
+    SimpleButton_Type_ShiftRegBurst_t       burst;
+
+    SimpleButton_Type_ShiftRegReadData_t    readData;
+
+    SimpleButton_Type_ShiftRegClock_t       clock;
+
+    uint8_t*                                buffer; /* `(inputCount + 7) / 8` bytes, for `burst` */
+
+    uint8_t                                 activeLow; /* the pushed level of the keys is 0 */
+
+} SimpleButton_Type_ShiftRegChain_t;
+
+SIMPLEBTN_C_API void
+SimpleButton_Source_SampleShiftReg(
+    void* context,
+    uint32_t* bitmap,
+    uint16_t inputCount
+);
+
+#endif /* SIMPLEBUTTON_SHIFTREG_H__ */
@@ -0,0 +1,246 @@
+/**
+ * @file            sBtn_source.c
+ *
+ * @author          Kim-J-Smith
+ *
+ * @brief           Source file of the input sources. This file contains
+ *                  functions for scanner-init, sampling every source once
+ *                  per scan, and feeding the inputs into the button state
+ *                  machine.
+ *
+ * @version         0.8.x
+ *
+ * @date            2025-10-03
+ *
+ * @attention       Copyright (c) 2025 Kim-J-Smith.
+ *                  All rights reserved.
+ *
+ * @copyright       SPDX-License-Identifier: MIT
+ *                  Refer to the LICENCE file in root for more details.
+ *                  <https://github.com/Kim-J-Smith/Simple-Button>
+ */
+#include    "sBtn_source.h"
+
+
+/* HOT : Trigger hotspot optimization */
+#if defined(__GNUC__) || defined(__clang__)
+ #define HOT_ __attribute__((hot))
+#elif defined(_MSC_VER) && ( _MSC_VER >= 1900 )
+ #define HOT_ __declspec(hot)
+#else
+ #define HOT_
+#endif /* HOT */
+
+/**
+ * @brief           Initialize the input scanner.
+ *
+ * @param[inout]    self - The pointer of the scanner.
+ * @param[in]       keys - Storage of `keyCapacity` keys.
+ * @param[in]       keyCapacity - The max number of inputs of all the sources.
+ * @param[in]       wordBuffer - Storage of `2 * wordCapacity` words.
+ * @param[in]       wordCapacity - The max number of bitmap words of all the sources.
+ * @param[inout]    sources - The descriptors of the sources. (must stay valid)
+ * @param[in]       sourceCount - The number of sources.
+ *
+ * @return          None
+ *
+ * @note            The sources which do not fit in `keyCapacity` / `wordCapacity`
+ *                  are not scanned. (panic in debug mode)
+ */
+SIMPLEBTN_C_API void
+SimpleButton_InputScan_Init(
+    SimpleButton_Type_InputScanner_t* const self,
+    simpleButton_Type_VirtualKey_t* const keys,
+    uint16_t keyCapacity,
+    uint32_t* const wordBuffer,
+    uint16_t wordCapacity,
+    SimpleButton_Type_InputSource_t* const sources,
+    uint8_t sourceCount
+) {
+    uint32_t keyCount = 0;
+    uint32_t wordCount = 0;
+    uint32_t i;
+    uint8_t count;
+
+#if defined(SIMPLEBTN_DEBUG)
+    if (0 == self || 0 == keys || 0 == wordBuffer || 0 == sources) {
+        SIMPLEBTN_FUNC_PANIC(
+            "invalid input in func:SimpleButton_InputScan_Init",
+            simpleButton_ErrorNum_invalidInput,
+        );
+    }
+#endif /* defined(SIMPLEBTN_DEBUG) */
+
+    /* only the sources which fit in the storage are scanned, before any of them is touched */
+    for (count = 0; count < sourceCount; count++) {
+        const uint32_t words = SIMPLEBTN_SOURCE_WORDS((uint32_t)sources[count].inputCount);
+
+        if (keyCount + sources[count].inputCount > keyCapacity || wordCount + words > wordCapacity) {
+            break;
+        }
+        keyCount += sources[count].inputCount;
+        wordCount += words;
+    }
+
+#if defined(SIMPLEBTN_DEBUG)
+    if (count != sourceCount) {
+        SIMPLEBTN_FUNC_PANIC(
+            "too many inputs in func:SimpleButton_InputScan_Init",
+            simpleButton_ErrorNum_invalidInput,
+        );
+    }
+#endif /* defined(SIMPLEBTN_DEBUG) */
+
+    keyCount = 0;
+    wordCount = 0;
+
+    SIMPLEBTN_FUNC_CRITICAL_SECTION_BEGIN(); /* critical section begin */
+
+    for (i = 0; i < count; i++) {
+        sources[i].firstKey = (uint16_t)keyCount;
+        sources[i].firstWord = (uint16_t)wordCount;
+        keyCount += sources[i].inputCount;
+        wordCount += SIMPLEBTN_SOURCE_WORDS((uint32_t)sources[i].inputCount);
+    }
+
+    self->keys = keys;
+    self->sources = sources;
+    self->pushed = wordBuffer;
+    self->active = wordBuffer + wordCapacity;
+    self->callBacks.shortPushCallBack = 0;
+    self->callBacks.longPushCallBack = 0;
+    self->callBacks.repeatPushCallBack = 0;
+    self->keyCount = (uint16_t)keyCount;
+    self->currentKey = 0;
+    self->sourceCount = count;
+
+    for (i = 0; i < wordCapacity; i++) {
+        self->pushed[i] = 0;
+        self->active[i] = 0;
+    }
+
+    for (i = 0; i < keyCount; i++) {
+        simpleButton_Private_InitStructPrivate(&(keys[i].Private));
+        simpleButton_Private_InitStructPublic(&(keys[i].Public));
+    }
+
+    SIMPLEBTN_FUNC_CRITICAL_SECTION_END(); /* critical section end */
+}
+
+/**
+ * @brief           Sample every source once and handle all the inputs.
+ *
+ * @param[inout]    self - The pointer of the scanner.
+ *
+ * @return          None
+ *
+ * @note            Each source is read exactly once per call, however many
+ *                  inputs it serves. Only the pushed inputs and the inputs
+ *                  which are not idle run the state machine.
+ */
+SIMPLEBTN_C_API HOT_ void
+SimpleButton_InputScan_Handler(
+    SimpleButton_Type_InputScanner_t* const self
+) {
+    uint8_t s;
+
+    for (s = 0; s < self->sourceCount; s++) {
+        const SimpleButton_Type_InputSource_t* const source = &(self->sources[s]);
+        uint32_t* const pushed = &(self->pushed[source->firstWord]);
+        uint32_t* const active = &(self->active[source->firstWord]);
+        const uint16_t words = (uint16_t)SIMPLEBTN_SOURCE_WORDS((uint32_t)source->inputCount);
+        uint16_t w;
+
+        for (w = 0; w < words; w++) {
+            pushed[w] = 0;
+        }
+
+        source->sampleAll(source->context, pushed, source->inputCount);
+
+        /* drop the bits beyond the last input */
+        if ((source->inputCount & 31U) != 0) {
+            pushed[words - 1] &= (1UL << (source->inputCount & 31U)) - 1U;
+        }
+
+        for (w = 0; w < words; w++) {
+            const uint16_t firstKey = (uint16_t)(source->firstKey + w * 32U);
+
+            active[w] = simpleButton_Private_ScanWord(
+                &(self->keys[firstKey]),
+                pushed[w],
+                active[w],
+                &(self->callBacks),
+                &(self->currentKey),
+                firstKey
+            );
+        }
+    }
+}
+
+/**
+ * @brief           Get the `Public` config of a key, to change its adjustable time,
+ *                  pressed/released events, ...
+ *
+ * @return          The pointer of `Public`, or 0 if the key does not exist.
+ */
+SIMPLEBTN_C_API simpleButton_Type_PublicBtnStatus_t*
+SimpleButton_InputScan_GetKeyPublic(
+    SimpleButton_Type_InputScanner_t* const self,
+    uint16_t key
+) {
+    if (key >= self->keyCount) {
+        return 0;
+    }
+
+    return &(self->keys[key].Public);
+}
+
+/**
+ * @brief           Check whether all the inputs of the scanner are idle.
+ *
+ * @return          Non-zero if all of them are in `Wait_For_Interrupt` state.
+ */
+SIMPLEBTN_C_API uint32_t
+SimpleButton_InputScan_AllIdle(
+    SimpleButton_Type_InputScanner_t* const self
+) {
+    uint8_t s;
+
+    for (s = 0; s < self->sourceCount; s++) {
+        const SimpleButton_Type_InputSource_t* const source = &(self->sources[s]);
+        const uint16_t words = (uint16_t)SIMPLEBTN_SOURCE_WORDS((uint32_t)source->inputCount);
+        uint16_t w;
+
+        for (w = 0; w < words; w++) {
+            if (self->active[source->firstWord + w] != 0 || self->pushed[source->firstWord + w] != 0) {
+                return 0;
+            }
+        }
+    }
+
+    return 1;
+}
+
+/**
+ * @brief           The sampler of discrete GPIO pins, using `SIMPLEBTN_FUNC_READ_PIN()`.
+ *
+ * @param[in]       context - An array of `inputCount` `SimpleButton_Type_SourcePin_t`.
+ *
+ * @note            Prefer a sampler which reads the whole port register once
+ *                  when the inputs share a port.
+ */
+SIMPLEBTN_C_API void
+SimpleButton_Source_SampleGpioPins(
+    void* context,
+    uint32_t* bitmap,
+    uint16_t inputCount
+) {
+    const SimpleButton_Type_SourcePin_t* const pins = (const SimpleButton_Type_SourcePin_t*)context;
+    uint16_t i;
+
+    for (i = 0; i < inputCount; i++) {
+        if (SIMPLEBTN_FUNC_READ_PIN(pins[i].GPIO_Base, pins[i].GPIO_Pin) != pins[i].normalPinVal) {
+            bitmap[i >> 5] |= (1UL << (i & 31U));
+        }
+    }
+}
@@ -0,0 +1,213 @@
+/**
+ * @file            sBtn_source.h
+ *
+ * @author          Kim-J-Smith
+ *
+ * @brief           Header file of the input sources. An input source fills
+ *                  a bitmap of all its inputs with one batched read (GPIO
+ *                  port, I2C/SPI GPIO expander, shift-register chain, ...),
+ *                  and every input drives a virtual button through the
+ *                  button state machine.
+ *
+ * @version         0.8.x
+ *
+ * @date            2025-10-03
+ *
+ * @attention       Copyright (c) 2025 Kim-J-Smith.
+ *                  All rights reserved.
+ *
+ * @copyright       SPDX-License-Identifier: MIT
+ *                  Refer to the LICENCE file in root for more details.
+ *                  <https://github.com/Kim-J-Smith/Simple-Button>
+ */
+#ifndef     SIMPLEBUTTON_SOURCE_H__
+#define     SIMPLEBUTTON_SOURCE_H__     1020L
+
+#include    "Simple_Button.h"
+#if ( SIMPLEBUTTON_SOURCE_H__ != SIMPLEBUTTON_H__ )
+ #warning [Simple-Button] : the version of "sBtn_source.h"\
+ is different from it of "Simple_Button.h".
+#endif /* SIMPLEBUTTON_SOURCE_H__ != SIMPLEBUTTON_H__ */
+
+/* The number of bitmap words of `n` inputs */
+#define SIMPLEBTN_SOURCE_WORDS(n)               (((n) + 31U) / 32U)
+
+/**
+ * Read all the inputs of a source at once. Set bit N (word N/32, bit N%32)
+ * of `bitmap` if input N is pushed. `bitmap` is cleared before the call.
+ */
+typedef void (* SimpleButton_Type_SourceSampleAll_t)(
+    void* context,
+    uint32_t* bitmap,
+    uint16_t inputCount
+);
+
+/**
+ * @struct      SimpleButton_Type_InputSource_t
+ *
+ * @brief       The descriptor of one input source.
+ */
+typedef struct SimpleButton_Type_InputSource_t {
+
+    SimpleButton_Type_SourceSampleAll_t sampleAll;
+
+    void*                           context; /* passed to `sampleAll` */
+
+    uint16_t                        inputCount;
+
+    uint16_t                        firstKey; /* set by init */
+
+    uint16_t                        firstWord; /* set by init */
+
+} SimpleButton_Type_InputSource_t;
+
+/* The context of `SimpleButton_Source_SampleGpioPins`, one entry per input */
+typedef struct SimpleButton_Type_SourcePin_t {
+
+    simpleButton_Type_GPIOBase_t    GPIO_Base;
+
+    simpleButton_Type_GPIOPin_t     GPIO_Pin;
+
+    simpleButton_Type_GPIOPinVal_t  normalPinVal;
+
+} SimpleButton_Type_SourcePin_t;
+
+/**
+ * @struct      SimpleButton_Type_InputScanner_t
+ *
+ * @brief       The scanner which reads the sources and handles their inputs.
+ *
+ * @note        The inputs of all the sources are numbered in order:
+ *              input N of source S is key `sources[S].firstKey + N`.
+ */
+typedef struct SimpleButton_Type_InputScanner_t {
+
+    simpleButton_Type_VirtualKey_t* keys;
+
+    SimpleButton_Type_InputSource_t* sources;
+
+    uint32_t*                       pushed; /* the sampled bitmap of each source */
+
+    uint32_t*                       active; /* keys which are not idle */
+
+    simpleButton_Type_CallBackSet_t callBacks;
+
+    uint16_t                        keyCount;
+
+    volatile uint16_t               currentKey; /* the key whose callback is running */
+
+    uint8_t                         sourceCount;
+
+} SimpleButton_Type_InputScanner_t;
+
+/**
+ * @def         SIMPLEBTN__INPUTSCAN_CREATE
+ * @brief       Create an input scanner with static storage.
+ * @param[in]   __keys - The max number of inputs of all the sources. (1 ~ 65535)
+ * @param[in]   __sources - The max number of sources. (1 ~ 255)
+ * @param[in]   __name - The name of the scanner.
+ * @note        Initialize it with `prefix/namespace` + `__name` + `_Init(sources, count)`.
+ */
+#define SIMPLEBTN__INPUTSCAN_CREATE(__keys, __sources, __name)                  \
+    static simpleButton_Type_VirtualKey_t                                       \
+    SIMPLEBTN_CONNECT2(simpleButton_Private_ScanKeys_, __name)[__keys];         \
+                                                                                \
+    static uint32_t                                                             \
+    SIMPLEBTN_CONNECT2(simpleButton_Private_ScanWords_, __name)                 \
+        [2 * (SIMPLEBTN_SOURCE_WORDS(__keys) + (__sources))];                   \
+                                                                                \
+    SimpleButton_Type_InputScanner_t                                            \
+    SIMPLEBTN_CONNECT2(SIMPLEBTN_NAMESPACE, __name);                            \
+                                                                                \
+    SIMPLEBTN_C_API void                                                        \
+    SIMPLEBTN_CONNECT3(SIMPLEBTN_NAMESPACE, __name, _Init)(                     \
+        SimpleButton_Type_InputSource_t* const sources,                         \
+        uint8_t sourceCount                                                     \
+    ) {                                                                         \
+        SimpleButton_InputScan_Init(                                            \
+            &(SIMPLEBTN_CONNECT2(SIMPLEBTN_NAMESPACE, __name)),                 \
+            SIMPLEBTN_CONNECT2(simpleButton_Private_ScanKeys_, __name),         \
+            (uint16_t)(__keys),                                                 \
+            SIMPLEBTN_CONNECT2(simpleButton_Private_ScanWords_, __name),        \
+            (uint16_t)(SIMPLEBTN_SOURCE_WORDS(__keys) + (__sources)),           \
+            sources,                                                            \
+            sourceCount                                                         \
+        );                                                                      \
+    }
+
+/**
+ * @def         SIMPLEBTN__INPUTSCAN_DECLARE
+ * @param[in]   __name - The name of scanner.
+ */
+#define SIMPLEBTN__INPUTSCAN_DECLARE(__name)                                    \
+    extern SimpleButton_Type_InputScanner_t                                     \
+    SIMPLEBTN_CONNECT2(SIMPLEBTN_NAMESPACE, __name);                            \
+    SIMPLEBTN_C_API void                                                        \
+    SIMPLEBTN_CONNECT3(SIMPLEBTN_NAMESPACE, __name, _Init)(                     \
+        SimpleButton_Type_InputSource_t* const sources,                         \
+        uint8_t sourceCount                                                     \
+    );
+
+/**
+ * @def             SIMPLEBTN__INPUTSCAN_SETCALLBACK
+ * @brief           Set the callback functions shared by all the inputs of a scanner.
+ *                  Use `SimpleButton_InputScan_CurrentKey()` in them to get the key.
+ */
+#define SIMPLEBTN__INPUTSCAN_SETCALLBACK(scanner, shortCB, longCB, repeatCB)            \
+    do {                                                                                \
+        (scanner).callBacks.shortPushCallBack = shortCB;                                \
+        (scanner).callBacks.longPushCallBack = longCB;                                  \
+        (scanner).callBacks.repeatPushCallBack = repeatCB;                              \
+    } while(0)
+
+SIMPLEBTN_C_API void
+SimpleButton_InputScan_Init(
+    SimpleButton_Type_InputScanner_t* const self,
+    simpleButton_Type_VirtualKey_t* const keys,
+    uint16_t keyCapacity,
+    uint32_t* const wordBuffer,
+    uint16_t wordCapacity,
+    SimpleButton_Type_InputSource_t* const sources,
+    uint8_t sourceCount
+);
+
+SIMPLEBTN_C_API void
+SimpleButton_InputScan_Handler(
+    SimpleButton_Type_InputScanner_t* const self
+);
+
+SIMPLEBTN_C_API simpleButton_Type_PublicBtnStatus_t*
+SimpleButton_InputScan_GetKeyPublic(
+    SimpleButton_Type_InputScanner_t* const self,
+    uint16_t key
+);
+
+SIMPLEBTN_C_API uint32_t
+SimpleButton_InputScan_AllIdle(
+    SimpleButton_Type_InputScanner_t* const self
+);
+
+SIMPLEBTN_C_API void
+SimpleButton_Source_SampleGpioPins(
+    void* context,
+    uint32_t* bitmap,
+    uint16_t inputCount
+);
+
+/**
+ * @brief   Get the key whose callback function is running.
+ * @return  The index of the key in the scanner.
+ */
+SIMPLEBTN_FORCE_INLINE uint16_t
+SimpleButton_InputScan_CurrentKey(
+    const SimpleButton_Type_InputScanner_t* const self
+) {
+#if SIMPLEBTN_MODE_ENABLE_DEFERRED_CALLBACK != 0
+    (void)self;
+    return SimpleButton_Deferred_CurrentKey(); /* the scanner may be on another key */
+#else
+    return self->currentKey;
+#endif /* SIMPLEBTN_MODE_ENABLE_DEFERRED_CALLBACK != 0 */
+}
+
+#endif /* SIMPLEBUTTON_SOURCE_H__ */
@@ -0,0 +1,443 @@
+/**
+ * @file            sBtn_timeout.c
+ *
+ * @author          Kim-J-Smith
+ *
+ * @brief           Source file of the timeout engine. This file contains
+ *                  functions for engine-init, the vectorized deadline check
+ *                  (SSE2 / AVX2 / scalar), and the planning of the next
+ *                  deadline of a key after each transition.
+ *
+ * @version         0.8.x
+ *
+ * @date            2025-10-03
+ *
+ * @attention       Copyright (c) 2025 Kim-J-Smith.
+ *                  All rights reserved.
+ *
+ * @copyright       SPDX-License-Identifier: MIT
+ *                  Refer to the LICENCE file in root for more details.
+ *                  <https://github.com/Kim-J-Smith/Simple-Button>
+ */
+#include    "sBtn_timeout.h"
+
+/* The widest vector unit the compiler is allowed to use (or SIMPLEBTN_TIMEOUT_LANES : 8, 4, 1) */
+#if defined(SIMPLEBTN_TIMEOUT_LANES)
+ #define SIMPLEBTN_TIMEOUT_LANES_               SIMPLEBTN_TIMEOUT_LANES
+#elif defined(__AVX2__)
+ #define SIMPLEBTN_TIMEOUT_LANES_               8U
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+ #define SIMPLEBTN_TIMEOUT_LANES_               4U
+#else
+ #define SIMPLEBTN_TIMEOUT_LANES_               1U
+#endif /* vector unit */
+
+#if SIMPLEBTN_TIMEOUT_LANES_ == 8U
+ #include   <immintrin.h>
+#elif SIMPLEBTN_TIMEOUT_LANES_ == 4U
+ #include   <emmintrin.h>
+#endif /* SIMPLEBTN_TIMEOUT_LANES_ */
+
+
+/* HOT : Trigger hotspot optimization */
+#if defined(__GNUC__) || defined(__clang__)
+ #define HOT_ __attribute__((hot))
+#elif defined(_MSC_VER) && ( _MSC_VER >= 1900 )
+ #define HOT_ __declspec(hot)
+#else
+ #define HOT_
+#endif /* HOT */
+
+/* a helper function : the index of the lowest set bit (x != 0) */
+SIMPLEBTN_FORCE_INLINE uint8_t
+simpleButton_Private_Timeout_LowestBit(uint32_t x)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return (uint8_t)__builtin_ctz(x);
+#else
+    uint8_t n = 0;
+    while ((x & 1U) == 0) {
+        x >>= 1;
+        n ++;
+    }
+    return n;
+#endif /* defined(__GNUC__) || defined(__clang__) */
+}
+
+/**
+ * @brief           Check the deadlines of 32 keys at once.
+ *
+ * @param[in]       deadline - The deadlines of the 32 keys.
+ * @param[in]       now - The current tick.
+ *
+ * @return          Bit N is set if the deadline of key N is over.
+ *
+ * @note            `now - deadline` is compared as a signed number, so the
+ *                  tick may wrap around (deadlines are less than 2^31 ticks away).
+ */
+SIMPLEBTN_FORCE_INLINE uint32_t
+simpleButton_Private_Timeout_Expired(
+    const uint32_t* const deadline,
+    const uint32_t now
+) {
+    uint32_t expired = 0;
+    uint8_t i;
+
+#if SIMPLEBTN_TIMEOUT_LANES_ == 8U
+    const __m256i now_v = _mm256_set1_epi32((int)now);
+    const __m256i minus1_v = _mm256_set1_epi32(-1);
+
+    for (i = 0; i < 32U; i += 8U) {
+        const __m256i left_v = _mm256_sub_epi32(now_v,
+            _mm256_loadu_si256((const __m256i*)(const void*)(deadline + i)));
+        const __m256i over_v = _mm256_cmpgt_epi32(left_v, minus1_v);
+        expired |= (uint32_t)_mm256_movemask_ps(_mm256_castsi256_ps(over_v)) << i;
+    }
+#elif SIMPLEBTN_TIMEOUT_LANES_ == 4U
+    const __m128i now_v = _mm_set1_epi32((int)now);
+    const __m128i minus1_v = _mm_set1_epi32(-1);
+
+    for (i = 0; i < 32U; i += 4U) {
+        const __m128i left_v = _mm_sub_epi32(now_v,
+            _mm_loadu_si128((const __m128i*)(const void*)(deadline + i)));
+        const __m128i over_v = _mm_cmpgt_epi32(left_v, minus1_v);
+        expired |= (uint32_t)_mm_movemask_ps(_mm_castsi128_ps(over_v)) << i;
+    }
+#else
+    for (i = 0; i < 32U; i++) {
+        if ((int32_t)(now - deadline[i]) >= 0) {
+            expired |= (1UL << i);
+        }
+    }
+#endif /* SIMPLEBTN_TIMEOUT_LANES_ */
+
+    return expired;
+}
+
+/* a helper function : the shortest time a key may stay pushed before its timed transition */
+SIMPLEBTN_FORCE_INLINE uint32_t
+simpleButton_Private_Timeout_HeldLimit(
+    const SimpleButton_Type_TimeoutEngine_t* const self,
+    const simpleButton_Type_PublicBtnStatus_t* const self_public
+) {
+    uint32_t limit = SIMPLEBTN_TIME__TIMEOUT_NORMAL;
+
+#if SIMPLEBTN_MODE_ENABLE_COMBINATION != 0
+    /* another key may turn this one into `Combination_WaitForEnd` */
+    if ((uint32_t)SIMPLEBTN_TIME__TIMEOUT_COMBINATION < limit) {
+        limit = SIMPLEBTN_TIME__TIMEOUT_COMBINATION;
+    }
+#endif /* SIMPLEBTN_MODE_ENABLE_COMBINATION != 0 */
+
+#if SIMPLEBTN_MODE_ENABLE_LONGPUSH_HOLD != 0
+    if (self->callBacks.longPushCallBack != 0) {
+ #if SIMPLEBTN_MODE_ENABLE_ADJUSTABLE_TIME != 0
+        if (self_public->holdPushMinTime < limit) {
+            limit = self_public->holdPushMinTime;
+        }
+ #else
+        if ((uint32_t)SIMPLEBTN_TIME_HOLD_PUSH_MIN < limit) {
+            limit = SIMPLEBTN_TIME_HOLD_PUSH_MIN;
+        }
+ #endif /* SIMPLEBTN_MODE_ENABLE_ADJUSTABLE_TIME != 0 */
+    }
+#else
+    (void)self;
+#endif /* SIMPLEBTN_MODE_ENABLE_LONGPUSH_HOLD != 0 */
+
+    (void)self_public;
+    return limit;
+}
+
+/**
+ * @brief           Plan the next deadline of a key from its state.
+ *
+ * @param[inout]    self - The pointer of the engine.
+ * @param[in]       key - The index of the key.
+ * @param[in]       now - The tick of this pass.
+ *
+ * @return          None
+ *
+ * @note            A deadline may come earlier than the real transition (the
+ *                  state machine then just does nothing), never later. States
+ *                  which must run in the next pass get `now` as deadline.
+ */
+static void
+simpleButton_Private_Timeout_Plan(
+    SimpleButton_Type_TimeoutEngine_t* const self,
+    const uint16_t key,
+    const uint32_t now
+) {
+    const simpleButton_Type_VirtualKey_t* const k = &(self->keys[key]);
+    const uint16_t word = (uint16_t)(key >> 5);
+    const uint32_t bit = 1UL << (key & 31U);
+    uint32_t deadline = now;
+    uint8_t is_timed = 1;
+    uint8_t care = 0;
+    uint8_t rest = 0;
+
+    switch ((simpleButton_Type_ButtonState_t)(k->Private.state)) {
+
+    case simpleButton_State_Wait_For_Interrupt: {
+        is_timed = 0;
+        care = 1;
+        break;
+    }
+
+    case simpleButton_State_Wait_For_Repeat: {
+        care = 1;
+        if (self->callBacks.repeatPushCallBack != 0) {
+#if SIMPLEBTN_MODE_ENABLE_ADJUSTABLE_TIME != 0
+            deadline = k->Private.timeStamp_loop + (uint32_t)k->Public.repeatWindowTime + 1U;
+#else
+            deadline = k->Private.timeStamp_loop + SIMPLEBTN_TIME_REPEAT_WINDOW + 1U;
+#endif /* SIMPLEBTN_MODE_ENABLE_ADJUSTABLE_TIME != 0 */
+        }
+        break;
+    }
+
+#if SIMPLEBTN_MODE_ENABLE_ADAPTIVE_DEBOUNCE == 0
+    /* (the adaptive debounce follows every bounce, so it runs in every pass) */
+    case simpleButton_State_Push_Delay: {
+        deadline = k->Private.timeStamp_interrupt + SIMPLEBTN_TIME_PUSH_DELAY + 1U;
+        break;
+    }
+
+    case simpleButton_State_Release_Delay: {
+        deadline = k->Private.timeStamp_loop + SIMPLEBTN_TIME_RELEASE_DELAY + 1U;
+        break;
+    }
+#endif /* SIMPLEBTN_MODE_ENABLE_ADAPTIVE_DEBOUNCE == 0 */
+
+    case simpleButton_State_Wait_For_End: {
+        care = 1;
+        rest = 1;
+        deadline = k->Private.timeStamp_interrupt + simpleButton_Private_Timeout_HeldLimit(self, &(k->Public)) + 1U;
+        break;
+    }
+
+    case simpleButton_State_Cool_Down: {
+#if SIMPLEBTN_MODE_ENABLE_ADJUSTABLE_TIME != 0
+        deadline = k->Private.timeStamp_loop + (uint32_t)k->Public.coolDownTime + 1U;
+#else
+        deadline = k->Private.timeStamp_loop + SIMPLEBTN_TIME_COOL_DOWN + 1U;
+#endif /* SIMPLEBTN_MODE_ENABLE_ADJUSTABLE_TIME != 0 */
+        break;
+    }
+
+#if SIMPLEBTN_MODE_ENABLE_COMBINATION != 0
+    case simpleButton_State_Combination_WaitForEnd: {
+        care = 1;
+        rest = 1;
+        deadline = k->Private.timeStamp_interrupt + SIMPLEBTN_TIME__TIMEOUT_COMBINATION + 1U;
+        break;
+    }
+
+    case simpleButton_State_Combination_Release: {
+        deadline = k->Private.timeStamp_loop + SIMPLEBTN_TIME_RELEASE_DELAY + 1U;
+        break;
+    }
+#endif /* SIMPLEBTN_MODE_ENABLE_COMBINATION != 0 */
+
+#if SIMPLEBTN_MODE_ENABLE_LONGPUSH_HOLD != 0
+    case simpleButton_State_Hold_Push: {
+        care = 1;
+        rest = 1;
+        deadline = k->Private.timeStamp_loop + SIMPLEBTN_TIME_HOLD_INTERVAL + 1U;
+        break;
+    }
+
+    case simpleButton_State_Hold_Release: {
+        deadline = k->Private.timeStamp_loop + SIMPLEBTN_TIME_RELEASE_DELAY + 1U;
+        break;
+    }
+#endif /* SIMPLEBTN_MODE_ENABLE_LONGPUSH_HOLD != 0 */
+
+    default: {
+        /* Single_Push, Repeat_Push, ... : run in the next pass */
+        break;
+    }
+
+    } /* end switch */
+
+    self->deadline[key] = deadline;
+
+    if (is_timed) {
+        self->timed[word] |= bit;
+    } else {
+        self->timed[word] &= ~bit;
+    }
+
+    if (care) {
+        self->levelCare[word] |= bit;
+    } else {
+        self->levelCare[word] &= ~bit;
+    }
+
+    if (rest) {
+        self->levelRest[word] |= bit;
+    } else {
+        self->levelRest[word] &= ~bit;
+    }
+}
+
+/**
+ * @brief           Initialize the timeout engine.
+ *
+ * @param[inout]    self - The pointer of the engine.
+ * @param[in]       keys - Storage of `keyCount` keys.
+ * @param[in]       deadlineBuffer - Storage of `32 * SIMPLEBTN_TIMEOUT_WORDS(keyCount)` words.
+ * @param[in]       wordBuffer - Storage of `3 * SIMPLEBTN_TIMEOUT_WORDS(keyCount)` words.
+ * @param[in]       keyCount - The number of keys. (1 ~ 65535)
+ *
+ * @return          None
+ */
+SIMPLEBTN_C_API void
+SimpleButton_Timeout_Init(
+    SimpleButton_Type_TimeoutEngine_t* const self,
+    simpleButton_Type_VirtualKey_t* const keys,
+    uint32_t* const deadlineBuffer,
+    uint32_t* const wordBuffer,
+    uint16_t keyCount
+) {
+    uint32_t i;
+
+#if defined(SIMPLEBTN_DEBUG)
+    if (0 == self || 0 == keys || 0 == deadlineBuffer || 0 == wordBuffer || keyCount == 0) {
+        SIMPLEBTN_FUNC_PANIC(
+            "invalid input in func:SimpleButton_Timeout_Init",
+            simpleButton_ErrorNum_invalidInput,
+        );
+    }
+#endif /* defined(SIMPLEBTN_DEBUG) */
+
+    SIMPLEBTN_FUNC_CRITICAL_SECTION_BEGIN(); /* critical section begin */
+
+    self->keys = keys;
+    self->deadline = deadlineBuffer;
+    self->wordCount = (uint16_t)SIMPLEBTN_TIMEOUT_WORDS((uint32_t)keyCount);
+    self->timed = wordBuffer;
+    self->levelCare = wordBuffer + self->wordCount;
+    self->levelRest = wordBuffer + 2U * self->wordCount;
+    self->callBacks.shortPushCallBack = 0;
+    self->callBacks.longPushCallBack = 0;
+    self->callBacks.repeatPushCallBack = 0;
+    self->handledCount = 0;
+    self->currentKey = 0;
+    self->keyCount = keyCount;
+
+    for (i = 0; i < 32U * self->wordCount; i++) {
+        deadlineBuffer[i] = 0;
+    }
+
+    /* every key waits for a push, the padding keys of the last word for nothing */
+    for (i = 0; i < self->wordCount; i++) {
+        self->timed[i] = 0;
+        self->levelCare[i] = 0xFFFFFFFFU;
+        self->levelRest[i] = 0;
+    }
+    if ((keyCount & 31U) != 0) {
+        self->levelCare[self->wordCount - 1U] = (1UL << (keyCount & 31U)) - 1U;
+    }
+
+    for (i = 0; i < keyCount; i++) {
+        simpleButton_Private_InitStructPrivate(&(keys[i].Private));
+        simpleButton_Private_InitStructPublic(&(keys[i].Public));
+    }
+
+    SIMPLEBTN_FUNC_CRITICAL_SECTION_END(); /* critical section end */
+}
+
+/**
+ * @brief           Handle the keys whose deadline is over or whose level changed.
+ *
+ * @param[inout]    self - The pointer of the engine.
+ * @param[in]       pushed - The sampled levels, bit N of `pushed[W]` is
+ *                  key `32 * W + N`. (`SIMPLEBTN_TIMEOUT_WORDS(keyCount)` words)
+ *
+ * @return          None
+ *
+ * @note            Cost : one vector compare for every 4 / 8 keys with a deadline
+ *                  (words without one are skipped), plus the state machine of
+ *                  the keys which are woken up. The other keys are not touched.
+ */
+SIMPLEBTN_C_API HOT_ void
+SimpleButton_Timeout_Handler(
+    SimpleButton_Type_TimeoutEngine_t* const self,
+    const uint32_t* const pushed
+) {
+    const uint32_t now = SIMPLEBTN_FUNC_GET_TICK();
+    uint16_t word;
+
+    for (word = 0; word < self->wordCount; word++) {
+        uint32_t work = (pushed[word] ^ self->levelRest[word]) & self->levelCare[word];
+
+        if (self->timed[word] != 0) {
+            work |= simpleButton_Private_Timeout_Expired(&(self->deadline[32U * word]), now)
+                & self->timed[word];
+        }
+
+        while (work != 0) {
+            const uint8_t bit = simpleButton_Private_Timeout_LowestBit(work);
+            const uint16_t key = (uint16_t)(32U * word + bit);
+            simpleButton_Type_VirtualKey_t* const k = &(self->keys[key]);
+
+            work &= work - 1U;
+
+            self->currentKey = key;
+            simpleButton_Private_PolledHandler(
+                &(k->Private),
+                &(k->Public),
+                (uint8_t)((pushed[word] >> bit) & 1U),
+                self->callBacks.shortPushCallBack,
+                self->callBacks.longPushCallBack,
+                self->callBacks.repeatPushCallBack,
+                &(self->currentKey)
+            );
+            self->handledCount ++;
+
+            simpleButton_Private_Timeout_Plan(self, key, now);
+        }
+    }
+}
+
+/**
+ * @brief           Get the `Public` config of a key, to change its adjustable time,
+ *                  pressed/released events, ...
+ *
+ * @return          The pointer of `Public`, or 0 if the key does not exist.
+ *
+ * @note            A new time is used from the next transition of the key.
+ */
+SIMPLEBTN_C_API simpleButton_Type_PublicBtnStatus_t*
+SimpleButton_Timeout_GetKeyPublic(
+    SimpleButton_Type_TimeoutEngine_t* const self,
+    uint16_t key
+) {
+    if (key >= self->keyCount) {
+        return 0;
+    }
+
+    return &(self->keys[key].Public);
+}
+
+/**
+ * @brief           Check whether all the keys of the engine are idle.
+ *
+ * @return          Non-zero if no key has a deadline. (all of them are in
+ *                  `Wait_For_Interrupt` state)
+ */
+SIMPLEBTN_C_API uint32_t
+SimpleButton_Timeout_AllIdle(
+    SimpleButton_Type_TimeoutEngine_t* const self
+) {
+    uint16_t word;
+
+    for (word = 0; word < self->wordCount; word++) {
+        if (self->timed[word] != 0) {
+            return 0;
+        }
+    }
+
+    return 1;
+}
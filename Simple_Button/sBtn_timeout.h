@@ -0,0 +1,166 @@
+/**
+ * @file            sBtn_timeout.h
+ *
+ * @author          Kim-J-Smith
+ *
+ * @brief           Header file of the timeout engine. Thousands of virtual
+ *                  keys keep their next deadline in one flat array, which is
+ *                  checked 4 / 8 keys at a time (SSE2 / AVX2, or one by one),
+ *                  so only the keys whose deadline is over or whose level
+ *                  changed are fed into the button state machine.
+ *
+ * @version         0.8.x
+ *
+ * @date            2025-10-03
+ *
+ * @attention       Copyright (c) 2025 Kim-J-Smith.
+ *                  All rights reserved.
+ *
+ * @copyright       SPDX-License-Identifier: MIT
+ *                  Refer to the LICENCE file in root for more details.
+ *                  <https://github.com/Kim-J-Smith/Simple-Button>
+ */
+#ifndef     SIMPLEBUTTON_TIMEOUT_H__
+#define     SIMPLEBUTTON_TIMEOUT_H__    1020L
+
+#include    "Simple_Button.h"
+#if ( SIMPLEBUTTON_TIMEOUT_H__ != SIMPLEBUTTON_H__ )
+ #warning [Simple-Button] : the version of "sBtn_timeout.h"\
+ is different from it of "Simple_Button.h".
+#endif /* SIMPLEBUTTON_TIMEOUT_H__ != SIMPLEBUTTON_H__ */
+
+/* The number of 32-key words for `__keys` keys */
+#define SIMPLEBTN_TIMEOUT_WORDS(__keys)         (((__keys) + 31U) / 32U)
+
+/**
+ * @struct      SimpleButton_Type_TimeoutEngine_t
+ *
+ * @brief       The timeout engine object.
+ *
+ * @note        The arrays are parallel to `keys`: `deadline[N]` is the tick of
+ *              the next timed transition of key N, bit N of `timed` is set if
+ *              it has one, bit N of `levelCare` is set if a level change wakes
+ *              it up, and bit N of `levelRest` is the level which does not.
+ */
+typedef struct SimpleButton_Type_TimeoutEngine_t {
+
+    simpleButton_Type_VirtualKey_t* keys;
+
+    uint32_t*                       deadline; /* 32 entries for each word */
+
+    uint32_t*                       timed;
+
+    uint32_t*                       levelCare;
+
+    uint32_t*                       levelRest;
+
+    simpleButton_Type_CallBackSet_t callBacks;
+
+    uint32_t                        handledCount; /* keys fed into the state machine */
+
+    volatile uint16_t               currentKey; /* the key whose callback is running */
+
+    uint16_t                        keyCount;
+
+    uint16_t                        wordCount;
+
+} SimpleButton_Type_TimeoutEngine_t;
+
+/**
+ * @def         SIMPLEBTN__TIMEOUT_CREATE
+ * @brief       Create a timeout engine with static storage.
+ * @param[in]   __keys - The number of keys. (1 ~ 65535)
+ * @param[in]   __name - The name of the engine.
+ * @note        Initialize it with `prefix/namespace` + `__name` + `_Init()`.
+ */
+#define SIMPLEBTN__TIMEOUT_CREATE(__keys, __name)                               \
+    static simpleButton_Type_VirtualKey_t                                       \
+    SIMPLEBTN_CONNECT2(simpleButton_Private_TimeoutKeys_, __name)[__keys];      \
+                                                                                \
+    static uint32_t                                                             \
+    SIMPLEBTN_CONNECT2(simpleButton_Private_TimeoutDeadline_, __name)[          \
+        32U * SIMPLEBTN_TIMEOUT_WORDS(__keys)];                                 \
+                                                                                \
+    static uint32_t                                                             \
+    SIMPLEBTN_CONNECT2(simpleButton_Private_TimeoutWords_, __name)[             \
+        3U * SIMPLEBTN_TIMEOUT_WORDS(__keys)];                                  \
+                                                                                \
+    SimpleButton_Type_TimeoutEngine_t                                           \
+    SIMPLEBTN_CONNECT2(SIMPLEBTN_NAMESPACE, __name);                            \
+                                                                                \
+    SIMPLEBTN_C_API void                                                        \
+    SIMPLEBTN_CONNECT3(SIMPLEBTN_NAMESPACE, __name, _Init)(void) {              \
+        SimpleButton_Timeout_Init(                                              \
+            &(SIMPLEBTN_CONNECT2(SIMPLEBTN_NAMESPACE, __name)),                 \
+            SIMPLEBTN_CONNECT2(simpleButton_Private_TimeoutKeys_, __name),      \
+            SIMPLEBTN_CONNECT2(simpleButton_Private_TimeoutDeadline_, __name),  \
+            SIMPLEBTN_CONNECT2(simpleButton_Private_TimeoutWords_, __name),     \
+            (uint16_t)(__keys)                                                  \
+        );                                                                      \
+    }
+
+/**
+ * @def         SIMPLEBTN__TIMEOUT_DECLARE
+ * @param[in]   __name - The name of engine.
+ */
+#define SIMPLEBTN__TIMEOUT_DECLARE(__name)                                      \
+    extern SimpleButton_Type_TimeoutEngine_t                                    \
+    SIMPLEBTN_CONNECT2(SIMPLEBTN_NAMESPACE, __name);                            \
+    SIMPLEBTN_C_API void                                                        \
+    SIMPLEBTN_CONNECT3(SIMPLEBTN_NAMESPACE, __name, _Init)(void);
+
+/**
+ * @def             SIMPLEBTN__TIMEOUT_SETCALLBACK
+ * @brief           Set the callback functions shared by all the keys of an engine.
+ *                  Use `SimpleButton_Timeout_CurrentKey()` in them to get the key.
+ */
+#define SIMPLEBTN__TIMEOUT_SETCALLBACK(engine, shortCB, longCB, repeatCB)               \
+    do {                                                                                \
+        (engine).callBacks.shortPushCallBack = shortCB;                                 \
+        (engine).callBacks.longPushCallBack = longCB;                                   \
+        (engine).callBacks.repeatPushCallBack = repeatCB;                               \
+    } while(0)
+
+SIMPLEBTN_C_API void
+SimpleButton_Timeout_Init(
+    SimpleButton_Type_TimeoutEngine_t* const self,
+    simpleButton_Type_VirtualKey_t* const keys,
+    uint32_t* const deadlineBuffer,
+    uint32_t* const wordBuffer,
+    uint16_t keyCount
+);
+
+SIMPLEBTN_C_API void
+SimpleButton_Timeout_Handler(
+    SimpleButton_Type_TimeoutEngine_t* const self,
+    const uint32_t* const pushed
+);
+
+SIMPLEBTN_C_API simpleButton_Type_PublicBtnStatus_t*
+SimpleButton_Timeout_GetKeyPublic(
+    SimpleButton_Type_TimeoutEngine_t* const self,
+    uint16_t key
+);
+
+SIMPLEBTN_C_API uint32_t
+SimpleButton_Timeout_AllIdle(
+    SimpleButton_Type_TimeoutEngine_t* const self
+);
+
+/**
+ * @brief   Get the key whose callback function is running.
+ * @return  The index of the key.
+ */
+SIMPLEBTN_FORCE_INLINE uint16_t
+SimpleButton_Timeout_CurrentKey(
+    const SimpleButton_Type_TimeoutEngine_t* const self
+) {
+#if SIMPLEBTN_MODE_ENABLE_DEFERRED_CALLBACK != 0
+    (void)self;
+    return SimpleButton_Deferred_CurrentKey(); /* the scanner may be on another key */
+#else
+    return self->currentKey;
+#endif /* SIMPLEBTN_MODE_ENABLE_DEFERRED_CALLBACK != 0 */
+}
+
+#endif /* SIMPLEBUTTON_TIMEOUT_H__ */
@@ -0,0 +1,125 @@
+/**
+ * @file            sBtn_touch.c
+ *
+ * @author          Kim-J-Smith
+ *
+ * @brief           Source file of the capacitive touch input source. This file
+ *                  contains the fixed-point filter, the baseline tracking and
+ *                  the touch/release decision of the pads.
+ *
+ * @version         0.8.x
+ *
+ * @date            2025-10-03
+ *
+ * @attention       Copyright (c) 2025 Kim-J-Smith.
+ *                  All rights reserved.
+ *
+ * @copyright       SPDX-License-Identifier: MIT
+ *                  Refer to the LICENCE file in root for more details.
+ *                  <https://github.com/Kim-J-Smith/Simple-Button>
+ */
+#include    "sBtn_touch.h"
+
+
+/* HOT : Trigger hotspot optimization */
+#if defined(__GNUC__) || defined(__clang__)
+ #define HOT_ __attribute__((hot))
+#elif defined(_MSC_VER) && ( _MSC_VER >= 1900 )
+ #define HOT_ __declspec(hot)
+#else
+ #define HOT_
+#endif /* HOT */
+
+/* a helper function : arithmetic right shift, also for negative value */
+SIMPLEBTN_FORCE_INLINE int32_t
+simpleButton_Private_Touch_Shift(const int32_t value, const uint8_t shift)
+{
+    return (value >= 0) ? (value >> shift) : -((-value) >> shift);
+}
+
+/**
+ * @brief           Filter one raw count and decide whether the pad is touched.
+ *
+ * @return          Non-zero if the pad is touched.
+ */
+SIMPLEBTN_FORCE_INLINE uint8_t
+simpleButton_Private_Touch_Update(
+    const SimpleButton_Type_TouchSensor_t* const sensor,
+    simpleButton_Type_TouchPad_t* const pad,
+    const uint16_t raw
+) {
+    const int32_t sample = (int32_t)raw << SIMPLEBTN_TOUCH_FRAC_BITS;
+    int32_t delta;
+
+    if (!pad->is_ready) {
+        pad->filtered = sample;
+        pad->baseline = sample;
+        pad->is_touched = 0;
+        pad->is_ready = 1;
+        return 0;
+    }
+
+    /* 1. IIR low-pass : filtered += (sample - filtered) / 2^filterShift */
+    pad->filtered += simpleButton_Private_Touch_Shift(sample - pad->filtered, sensor->filterShift);
+
+    delta = pad->filtered - pad->baseline;
+    if (sensor->countDrops) {
+        delta = -delta;
+    }
+    delta = simpleButton_Private_Touch_Shift(delta, SIMPLEBTN_TOUCH_FRAC_BITS);
+
+    /* 2. touch/release with hysteresis */
+    if (pad->is_touched) {
+        pad->touchScans ++;
+        if (delta < (int32_t)sensor->releaseDelta) {
+            pad->is_touched = 0;
+        } else if (sensor->maxTouchScans != 0 && pad->touchScans >= sensor->maxTouchScans) {
+            pad->baseline = pad->filtered; /* stuck by drift, take it as the new baseline */
+            pad->is_touched = 0;
+        }
+    } else if (delta >= (int32_t)sensor->touchDelta) {
+        pad->is_touched = 1;
+        pad->touchScans = 0;
+    }
+
+    /* 3. the baseline follows the drift while released, and jumps back at once
+          when the count moves the other way (a touch at power-on, water, ...) */
+    if (!pad->is_touched) {
+        if (delta < 0) {
+            pad->baseline = pad->filtered;
+        } else {
+            pad->baseline += simpleButton_Private_Touch_Shift(pad->filtered - pad->baseline, sensor->baselineShift);
+        }
+    }
+
+    return pad->is_touched;
+}
+
+/**
+ * @brief           The sampler of capacitive touch pads. Pad N is input N.
+ *
+ * @param[in]       context - The pointer of a `SimpleButton_Type_TouchSensor_t`.
+ * @param[out]      bitmap - Bit N is set if pad N is touched.
+ * @param[in]       inputCount - The number of pads.
+ *
+ * @return          None
+ *
+ * @note            Integer add/shift only : no multiply, no division.
+ */
+SIMPLEBTN_C_API HOT_ void
+SimpleButton_Source_SampleTouch(
+    void* context,
+    uint32_t* bitmap,
+    uint16_t inputCount
+) {
+    const SimpleButton_Type_TouchSensor_t* const sensor = (const SimpleButton_Type_TouchSensor_t*)context;
+    uint16_t i;
+
+    for (i = 0; i < inputCount; i++) {
+        const uint16_t raw = sensor->readPad((uint8_t)i);
+
+        if (simpleButton_Private_Touch_Update(sensor, &(sensor->pads[i]), raw)) {
+            bitmap[i >> 5] |= (1UL << (i & 31U));
+        }
+    }
+}
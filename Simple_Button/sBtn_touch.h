@@ -0,0 +1,90 @@
+/**
+ * @file            sBtn_touch.h
+ *
+ * @author          Kim-J-Smith
+ *
+ * @brief           Header file of the capacitive touch input source. The raw
+ *                  count of every pad is filtered, compared with a drifting
+ *                  baseline, and turned into a pushed/released input of
+ *                  `sBtn_source.h`.
+ *
+ * @version         0.8.x
+ *
+ * @date            2025-10-03
+ *
+ * @attention       Copyright (c) 2025 Kim-J-Smith.
+ *                  All rights reserved.
+ *
+ * @copyright       SPDX-License-Identifier: MIT
+ *                  Refer to the LICENCE file in root for more details.
+ *                  <https://github.com/Kim-J-Smith/Simple-Button>
+ */
+#ifndef     SIMPLEBUTTON_TOUCH_H__
+#define     SIMPLEBUTTON_TOUCH_H__      1020L
+
+#include    "sBtn_source.h"
+#if ( SIMPLEBUTTON_TOUCH_H__ != SIMPLEBUTTON_H__ )
+ #warning [Simple-Button] : the version of "sBtn_touch.h"\
+ is different from it of "Simple_Button.h".
+#endif /* SIMPLEBUTTON_TOUCH_H__ != SIMPLEBUTTON_H__ */
+
+/* The fraction bits of the filtered count and of the baseline */
+#define SIMPLEBTN_TOUCH_FRAC_BITS               8
+
+/* Read the raw capacitance count of a pad. */
+typedef uint16_t (* SimpleButton_Type_TouchRead_t)(uint8_t pad);
+
+/* The filter state of one pad. (internal use) */
+typedef struct simpleButton_Type_TouchPad_t {
+
+    int32_t     filtered; /* IIR filtered count, with `SIMPLEBTN_TOUCH_FRAC_BITS` fraction bits */
+
+    int32_t     baseline; /* untouched count, with `SIMPLEBTN_TOUCH_FRAC_BITS` fraction bits */
+
+    uint16_t    touchScans; /* scans since the touch began */
+
+    uint8_t     is_touched;
+
+    uint8_t     is_ready; /* the filter has been seeded */
+
+} simpleButton_Type_TouchPad_t;
+
+/**
+ * @struct      SimpleButton_Type_TouchSensor_t
+ *
+ * @brief       The context of `SimpleButton_Source_SampleTouch`.
+ *
+ * @note        A pad is touched when the filtered count moves `touchDelta`
+ *              away from its baseline, and released when it comes back
+ *              within `releaseDelta` (`releaseDelta < touchDelta`). The
+ *              baseline follows slow drift only while the pad is released,
+ *              so a pad touched for `maxTouchScans` scans is recalibrated.
+ */
+typedef struct SimpleButton_Type_TouchSensor_t {
+
+    SimpleButton_Type_TouchRead_t   readPad;
+
+    simpleButton_Type_TouchPad_t*   pads; /* `inputCount` pads, zero them before the first scan */
+
+    uint16_t    touchDelta;
+
+    uint16_t    releaseDelta;
+
+    uint16_t    maxTouchScans; /* a touch longer than this is drift, recalibrate (0 : never) */
+
+    uint8_t     filterShift; /* 0 ~ 8, the larger the smoother */
+
+    uint8_t     baselineShift; /* 0 ~ 16, the larger the slower the baseline drifts */
+
+    uint8_t     countDrops; /* the count gets lower when touched */
+
+} SimpleButton_Type_TouchSensor_t;
+
+SIMPLEBTN_C_API void
+SimpleButton_Source_SampleTouch(
+    void* context,
+    uint32_t* bitmap,
+    uint16_t inputCount
+);
+
+#endif /* SIMPLEBUTTON_TOUCH_H__ */
@@ -0,0 +1,232 @@
+/**
+ * @file            sBtn_velocity.c
+ *
+ * @author          Kim-J-Smith
+ *
+ * @brief           Source file of the velocity-sensing keys. This file
+ *                  contains the two-contact state machine run in interrupt,
+ *                  the velocity lookup and the note event queue.
+ *
+ * @version         0.8.x
+ *
+ * @date            2025-10-03
+ *
+ * @attention       Copyright (c) 2025 Kim-J-Smith.
+ *                  All rights reserved.
+ *
+ * @copyright       SPDX-License-Identifier: MIT
+ *                  Refer to the LICENCE file in root for more details.
+ *                  <https://github.com/Kim-J-Smith/Simple-Button>
+ */
+#include    "sBtn_velocity.h"
+
+
+/* HOT : Trigger hotspot optimization */
+#if defined(__GNUC__) || defined(__clang__)
+ #define HOT_ __attribute__((hot))
+#elif defined(_MSC_VER) && ( _MSC_VER >= 1900 )
+ #define HOT_ __declspec(hot)
+#else
+ #define HOT_
+#endif /* HOT */
+
+/* The state of a velocity key */
+#define SIMPLEBTN_VELOCITY_STATE_IDLE_          0U  /* both contacts open */
+#define SIMPLEBTN_VELOCITY_STATE_STRIKE_        1U  /* first contact closed, timing */
+#define SIMPLEBTN_VELOCITY_STATE_ON_            2U  /* both contacts closed, note is on */
+#define SIMPLEBTN_VELOCITY_STATE_LIFT_          3U  /* second contact open, timing the release */
+
+const uint8_t SimpleButton_Velocity_DefaultCurve[32] = {
+    127, 102,  87,  77,  68,  62,  56,  51,
+     47,  43,  40,  37,  34,  31,  29,  26,
+     24,  22,  20,  18,  16,  15,  13,  11,
+     10,   9,   7,   6,   5,   3,   2,   1,
+};
+
+/* a helper function : look up the velocity of a contact-to-contact time */
+SIMPLEBTN_FORCE_INLINE uint8_t
+simpleButton_Private_Velocity_Lookup(
+    const SimpleButton_Type_VelocityKeyboard_t* const self,
+    const uint32_t elapsed_us
+) {
+    uint32_t index = elapsed_us / self->curveStepUs;
+
+    if (index >= self->curveSize) {
+        index = self->curveSize - 1U;
+    }
+
+    return self->curve[index];
+}
+
+/* a helper function : queue one note event (only called in interrupt) */
+SIMPLEBTN_FORCE_INLINE void
+simpleButton_Private_Velocity_Push(
+    SimpleButton_Type_VelocityKeyboard_t* const self,
+    const uint16_t key,
+    const uint8_t velocity,
+    const uint8_t is_on
+) {
+    const uint16_t head = self->head;
+
+    if ((uint16_t)(head - self->tail) >= SIMPLEBTN_VELOCITY_QUEUE_SIZE) {
+        self->dropCount ++;
+        return;
+    }
+
+    self->queue[head & (SIMPLEBTN_VELOCITY_QUEUE_SIZE - 1U)].key = key;
+    self->queue[head & (SIMPLEBTN_VELOCITY_QUEUE_SIZE - 1U)].velocity = velocity;
+    self->queue[head & (SIMPLEBTN_VELOCITY_QUEUE_SIZE - 1U)].is_on = is_on;
+
+    SIMPLEBTN_FUNC_MEMORY_BARRIER(); /* the event is complete before it is published */
+    self->head = (uint16_t)(head + 1U);
+}
+
+/**
+ * @brief           Initialize the velocity keyboard.
+ *
+ * @param[inout]    self - The pointer of the keyboard.
+ * @param[in]       keys - Storage of `keyCount` keys.
+ * @param[in]       keyCount - The number of keys.
+ * @param[in]       curve - The velocity curve. (must stay valid)
+ * @param[in]       curveSize - The number of entries in `curve`. (1 ~ 255)
+ * @param[in]       curveStepUs - The microseconds of each entry.
+ *
+ * @return          None
+ */
+SIMPLEBTN_C_API void
+SimpleButton_Velocity_Init(
+    SimpleButton_Type_VelocityKeyboard_t* const self,
+    simpleButton_Type_VelocityKey_t* const keys,
+    uint16_t keyCount,
+    const uint8_t* curve,
+    uint8_t curveSize,
+    uint16_t curveStepUs
+) {
+    uint16_t i;
+
+#if defined(SIMPLEBTN_DEBUG)
+    if (0 == self || 0 == keys || 0 == curve || curveSize == 0 || curveStepUs == 0) {
+        SIMPLEBTN_FUNC_PANIC(
+            "invalid input in func:SimpleButton_Velocity_Init",
+            simpleButton_ErrorNum_invalidInput,
+        );
+    }
+#endif /* defined(SIMPLEBTN_DEBUG) */
+
+    SIMPLEBTN_FUNC_CRITICAL_SECTION_BEGIN(); /* critical section begin */
+
+    self->keys = keys;
+    self->curve = curve;
+    self->head = 0;
+    self->tail = 0;
+    self->dropCount = 0;
+    self->keyCount = keyCount;
+    self->curveStepUs = curveStepUs;
+    self->curveSize = curveSize;
+
+    for (i = 0; i < keyCount; i++) {
+        keys[i].timeStamp_us = 0;
+        keys[i].state = SIMPLEBTN_VELOCITY_STATE_IDLE_;
+    }
+
+    SIMPLEBTN_FUNC_CRITICAL_SECTION_END(); /* critical section end */
+}
+
+/**
+ * @brief           Report one contact edge of a key. Called in the EXTI
+ *                  interrupt (or a fast scan) of the contact.
+ *
+ * @param[inout]    self - The pointer of the keyboard.
+ * @param[in]       key - The index of the key.
+ * @param[in]       contact - `SIMPLEBTN_VELOCITY_CONTACT_FIRST` or `_SECOND`.
+ * @param[in]       is_closed - The contact is closed now.
+ *
+ * @return          None
+ *
+ * @note            O(1) and no loop : one timestamp, one state change and at
+ *                  most one queued event, however many keys there are.
+ *
+ * @attention       All the contact interrupts must have the same priority,
+ *                  the queue has only one producer.
+ */
+SIMPLEBTN_C_API HOT_ void
+SimpleButton_Velocity_ContactISR(
+    SimpleButton_Type_VelocityKeyboard_t* const self,
+    uint16_t key,
+    uint8_t contact,
+    uint8_t is_closed
+) {
+    simpleButton_Type_VelocityKey_t* const pkey = &(self->keys[key]);
+    const uint32_t now = (uint32_t)SIMPLEBTN_FUNC_GET_TIME_US_FromISR();
+
+    switch (pkey->state) {
+    case SIMPLEBTN_VELOCITY_STATE_IDLE_:
+        if (contact == SIMPLEBTN_VELOCITY_CONTACT_FIRST && is_closed) {
+            pkey->timeStamp_us = now;
+            pkey->state = SIMPLEBTN_VELOCITY_STATE_STRIKE_;
+        }
+        break;
+
+    case SIMPLEBTN_VELOCITY_STATE_STRIKE_:
+        if (contact == SIMPLEBTN_VELOCITY_CONTACT_SECOND && is_closed) {
+            simpleButton_Private_Velocity_Push(self, key,
+                simpleButton_Private_Velocity_Lookup(self, now - pkey->timeStamp_us), 1);
+            pkey->state = SIMPLEBTN_VELOCITY_STATE_ON_;
+        } else if (contact == SIMPLEBTN_VELOCITY_CONTACT_FIRST && !is_closed) {
+            pkey->state = SIMPLEBTN_VELOCITY_STATE_IDLE_; /* half press, no note */
+        }
+        break;
+
+    case SIMPLEBTN_VELOCITY_STATE_ON_:
+        if (contact == SIMPLEBTN_VELOCITY_CONTACT_SECOND && !is_closed) {
+            pkey->timeStamp_us = now;
+            pkey->state = SIMPLEBTN_VELOCITY_STATE_LIFT_;
+        }
+        break;
+
+    case SIMPLEBTN_VELOCITY_STATE_LIFT_:
+        if (contact == SIMPLEBTN_VELOCITY_CONTACT_FIRST && !is_closed) {
+            simpleButton_Private_Velocity_Push(self, key,
+                simpleButton_Private_Velocity_Lookup(self, now - pkey->timeStamp_us), 0);
+            pkey->state = SIMPLEBTN_VELOCITY_STATE_IDLE_;
+        } else if (contact == SIMPLEBTN_VELOCITY_CONTACT_SECOND && is_closed) {
+            pkey->state = SIMPLEBTN_VELOCITY_STATE_ON_; /* bounce of the second contact */
+        }
+        break;
+
+    default:
+        pkey->state = SIMPLEBTN_VELOCITY_STATE_IDLE_;
+        break;
+    }
+}
+
+/**
+ * @brief           Deliver the queued note events. Called in while loop.
+ *
+ * @param[inout]    self - The pointer of the keyboard.
+ * @param[in]       noteCallBack - The note callback function.
+ *
+ * @return          None
+ */
+SIMPLEBTN_C_API void
+SimpleButton_Velocity_Handler(
+    SimpleButton_Type_VelocityKeyboard_t* const self,
+    SimpleButton_Type_NoteCallBack_t noteCallBack
+) {
+    uint16_t tail = self->tail;
+
+    while (tail != self->head) {
+        simpleButton_Type_NoteEvent_t event;
+
+        SIMPLEBTN_FUNC_MEMORY_BARRIER(); /* the event is read after the head */
+        event = self->queue[tail & (SIMPLEBTN_VELOCITY_QUEUE_SIZE - 1U)];
+
+        tail = (uint16_t)(tail + 1U);
+        SIMPLEBTN_FUNC_MEMORY_BARRIER(); /* the event is read before its slot is freed */
+        self->tail = tail; /* free the slot before the callback */
+
+        if (noteCallBack != 0) {
+            noteCallBack(event.key, event.velocity, event.is_on);
+        }
+    }
+}
@@ -0,0 +1,175 @@
+/**
+ * @file            sBtn_velocity.h
+ *
+ * @author          Kim-J-Smith
+ *
+ * @brief           Header file of the velocity-sensing keys. Each key has two
+ *                  contacts, the EXTI interrupt timestamps both of them in
+ *                  microsecond, and the time between them is turned into a
+ *                  strike velocity with a lookup curve. Note-on/off events
+ *                  are queued by the interrupt and delivered in while loop.
+ *
+ * @version         0.8.x
+ *
+ * @date            2025-10-03
+ *
+ * @attention       Copyright (c) 2025 Kim-J-Smith.
+ *                  All rights reserved.
+ *
+ * @copyright       SPDX-License-Identifier: MIT
+ *                  Refer to the LICENCE file in root for more details.
+ *                  <https://github.com/Kim-J-Smith/Simple-Button>
+ */
+#ifndef     SIMPLEBUTTON_VELOCITY_H__
+#define     SIMPLEBUTTON_VELOCITY_H__   1020L
+
+#include    "Simple_Button.h"
+#if ( SIMPLEBUTTON_VELOCITY_H__ != SIMPLEBUTTON_H__ )
+ #warning [Simple-Button] : the version of "sBtn_velocity.h"\
+ is different from it of "Simple_Button.h".
+#endif /* SIMPLEBUTTON_VELOCITY_H__ != SIMPLEBUTTON_H__ */
+
+/* The size of the note event queue (power of 2) */
+#ifndef SIMPLEBTN_VELOCITY_QUEUE_SIZE
+ #define SIMPLEBTN_VELOCITY_QUEUE_SIZE          32
+#endif /* SIMPLEBTN_VELOCITY_QUEUE_SIZE */
+
+#if ( SIMPLEBTN_VELOCITY_QUEUE_SIZE & (SIMPLEBTN_VELOCITY_QUEUE_SIZE - 1) ) != 0
+ #error [Simple-Button] : SIMPLEBTN_VELOCITY_QUEUE_SIZE must be a power of 2.
+#endif
+
+/* The note queue is published by the interrupt without a lock */
+#ifndef SIMPLEBTN_FUNC_MEMORY_BARRIER
+ #if defined(__GNUC__) || defined(__clang__)
+  #define SIMPLEBTN_FUNC_MEMORY_BARRIER()   __atomic_thread_fence(__ATOMIC_SEQ_CST)
+ #else
+  #error [Simple-Button] : the velocity keyboard needs SIMPLEBTN_FUNC_MEMORY_BARRIER() on this compiler.
+ #endif
+#endif /* SIMPLEBTN_FUNC_MEMORY_BARRIER */
+
+/* The two contacts of a key */
+#define SIMPLEBTN_VELOCITY_CONTACT_FIRST        0U  /* closes first, near the top */
+#define SIMPLEBTN_VELOCITY_CONTACT_SECOND       1U  /* closes last, at the bottom */
+
+/**
+ * The note callback function, called in while loop.
+ * `velocity` : 1 ~ 127 for note-on, the release velocity for note-off.
+ */
+typedef void (* SimpleButton_Type_NoteCallBack_t)(uint16_t key, uint8_t velocity, uint8_t is_on);
+
+/* The state of one key. (internal use) */
+typedef struct simpleButton_Type_VelocityKey_t {
+
+    uint32_t            timeStamp_us; /* the last contact edge */
+
+    uint8_t             state;
+
+} simpleButton_Type_VelocityKey_t;
+
+/* One note event. (internal use) */
+typedef struct simpleButton_Type_NoteEvent_t {
+
+    uint16_t            key;
+
+    uint8_t             velocity;
+
+    uint8_t             is_on;
+
+} simpleButton_Type_NoteEvent_t;
+
+/**
+ * @struct      SimpleButton_Type_VelocityKeyboard_t
+ *
+ * @brief       The velocity keyboard object.
+ *
+ * @note        `curve[i]` is the velocity of a strike taking
+ *              `i * curveStepUs` ~ `(i + 1) * curveStepUs` microsecond from
+ *              the first contact to the second. Slower strikes use the
+ *              last entry.
+ */
+typedef struct SimpleButton_Type_VelocityKeyboard_t {
+
+    simpleButton_Type_VelocityKey_t* keys;
+
+    const uint8_t*      curve;
+
+    simpleButton_Type_NoteEvent_t queue[SIMPLEBTN_VELOCITY_QUEUE_SIZE];
+
+    volatile uint16_t   head; /* only written in interrupt */
+
+    volatile uint16_t   tail; /* only written in while loop */
+
+    volatile uint32_t   dropCount; /* events lost because the queue is full */
+
+    uint16_t            keyCount;
+
+    uint16_t            curveStepUs;
+
+    uint8_t             curveSize;
+
+} SimpleButton_Type_VelocityKeyboard_t;
+
+/* The default velocity curve : 32 entries, 1 ms each, logarithmic */
+extern const uint8_t SimpleButton_Velocity_DefaultCurve[32];
+
+/**
+ * @def         SIMPLEBTN__VELOCITY_CREATE
+ * @brief       Create a velocity keyboard with static storage, using the default curve.
+ * @param[in]   __keys - The number of keys. (1 ~ 65535)
+ * @param[in]   __name - The name of the keyboard.
+ * @note        Initialize it with `prefix/namespace` + `__name` + `_Init()`.
+ */
+#define SIMPLEBTN__VELOCITY_CREATE(__keys, __name)                              \
+    static simpleButton_Type_VelocityKey_t                                      \
+    SIMPLEBTN_CONNECT2(simpleButton_Private_VelocityKeys_, __name)[__keys];     \
+                                                                                \
+    SimpleButton_Type_VelocityKeyboard_t                                        \
+    SIMPLEBTN_CONNECT2(SIMPLEBTN_NAMESPACE, __name);                            \
+                                                                                \
+    SIMPLEBTN_C_API void                                                        \
+    SIMPLEBTN_CONNECT3(SIMPLEBTN_NAMESPACE, __name, _Init)(void) {              \
+        SimpleButton_Velocity_Init(                                             \
+            &(SIMPLEBTN_CONNECT2(SIMPLEBTN_NAMESPACE, __name)),                 \
+            SIMPLEBTN_CONNECT2(simpleButton_Private_VelocityKeys_, __name),     \
+            (uint16_t)(__keys),                                                 \
+            SimpleButton_Velocity_DefaultCurve,                                 \
+            (uint8_t)sizeof(SimpleButton_Velocity_DefaultCurve),                \
+            1000U                                                               \
+        );                                                                      \
+    }
+
+/**
+ * @def         SIMPLEBTN__VELOCITY_DECLARE
+ * @param[in]   __name - The name of keyboard.
+ */
+#define SIMPLEBTN__VELOCITY_DECLARE(__name)                                     \
+    extern SimpleButton_Type_VelocityKeyboard_t                                 \
+    SIMPLEBTN_CONNECT2(SIMPLEBTN_NAMESPACE, __name);                            \
+    SIMPLEBTN_C_API void                                                        \
+    SIMPLEBTN_CONNECT3(SIMPLEBTN_NAMESPACE, __name, _Init)(void);
+
+SIMPLEBTN_C_API void
+SimpleButton_Velocity_Init(
+    SimpleButton_Type_VelocityKeyboard_t* const self,
+    simpleButton_Type_VelocityKey_t* const keys,
+    uint16_t keyCount,
+    const uint8_t* curve,
+    uint8_t curveSize,
+    uint16_t curveStepUs
+);
+
+SIMPLEBTN_C_API void
+SimpleButton_Velocity_ContactISR(
+    SimpleButton_Type_VelocityKeyboard_t* const self,
+    uint16_t key,
+    uint8_t contact,
+    uint8_t is_closed
+);
+
+SIMPLEBTN_C_API void
+SimpleButton_Velocity_Handler(
+    SimpleButton_Type_VelocityKeyboard_t* const self,
+    SimpleButton_Type_NoteCallBack_t noteCallBack
+);
+
+#endif /* SIMPLEBUTTON_VELOCITY_H__ */
@@ -87,6 +87,19 @@ typedef uint32_t            simpleButton_Type_EXTITrigger_t;
 #define SIMPLEBTN_FUNC_START_LOW_POWER() \
     /* for example: __WFI() */
 
+#define SIMPLEBTN_FUNC_DEFERRED_PEND() \
+    /* for example: (SCB->ICSR = SCB_ICSR_PENDSVSET_Msk), only used in DEFERRED_CALLBACK mode */
+
+#define SIMPLEBTN_FUNC_TIMER_START() \
+    /* for example: HAL_TIM_Base_Start_IT(&htim6), only used in TIMER_DRIVEN mode */
+
+#define SIMPLEBTN_FUNC_TIMER_STOP() \
+    /* for example: HAL_TIM_Base_Stop_IT(&htim6), only used in TIMER_DRIVEN mode */
+
+#define SIMPLEBTN_FUNC_TIMER_RELOAD(periodMs) \
+    /* for example: (__HAL_TIM_SET_AUTORELOAD(&htim6, (periodMs) * 1000 - 1), __HAL_TIM_SET_COUNTER(&htim6, 0)),
+        only used in TIMER_DRIVEN + ADAPTIVE_POLLING mode */
+
 /** @b ================================================================ **/
 /** @b Time-Set */
 
@@ -108,6 +121,20 @@ typedef uint32_t            simpleButton_Type_EXTITrigger_t;
 #define SIMPLEBTN_TIME__TIMEOUT_NORMAL                  (1000 * 120)
     // The timeout time for combination long button.
 #define SIMPLEBTN_TIME__TIMEOUT_COMBINATION             (1000 * 240)
+    // The lower bound of the learned bounce time in adaptive-debounce mode.
+#define SIMPLEBTN_TIME_DEBOUNCE_MIN                     2
+    // The safety margin added to the learned bounce time in adaptive-debounce mode.
+#define SIMPLEBTN_TIME_DEBOUNCE_MARGIN                  3
+    // The maximum push count of repeat-push. (decide at once when it is reached)
+#define SIMPLEBTN_REPEAT_MAX_COUNT                      0xFF
+    // The max idle time between two events of a gesture sequence.
+#define SIMPLEBTN_TIME_GESTURE_TIMEOUT                  1500
+    // The max time from the first key of a chord to the last.
+#define SIMPLEBTN_TIME_CHORD_WINDOW                     50
+    // The period of the timer interrupt in timer-driven mode. (set the timer to it)
+#define SIMPLEBTN_TIME_TIMER_PERIOD                     1
+    // The poll interval of an idle dynamic-button in adaptive polling mode.
+#define SIMPLEBTN_TIME_IDLE_POLL_INTERVAL               20
 
 /** @b ================================================================ **/
 /** @b Mode-Set */
@@ -126,6 +153,22 @@ typedef uint32_t            simpleButton_Type_EXTITrigger_t;
 #define SIMPLEBTN_MODE_ENABLE_MULTI_THREADS             1
     // Enable long-push-hold mode if this macro is defined as 1.
 #define SIMPLEBTN_MODE_ENABLE_LONGPUSH_HOLD             1
+    // Enable adaptive-debounce mode (learn the bounce time of each button) if this macro is defined as 1.
+#define SIMPLEBTN_MODE_ENABLE_ADAPTIVE_DEBOUNCE         0
+    // Enable pressed/released event mode if this macro is defined as 1.
+#define SIMPLEBTN_MODE_ENABLE_PRESS_RELEASE_EVENT       0
+    // Enable registry mode (handle / init all buttons without listing them) if this macro is defined as 1.
+#define SIMPLEBTN_MODE_ENABLE_REGISTRY                  0
+    // Enable lock-free handoff mode (ISR and loop swap the state by CAS, no interrupt masking) if this macro is defined as 1.
+#define SIMPLEBTN_MODE_ENABLE_LOCKFREE_HANDOFF          0
+    // Enable snapshot mode (read the state of a button from any thread / ISR without critical section) if this macro is defined as 1.
+#define SIMPLEBTN_MODE_ENABLE_SNAPSHOT                  0
+    // Enable deferred callback mode (callbacks are queued and called by SimpleButton_Deferred_Drain()) if this macro is defined as 1.
+#define SIMPLEBTN_MODE_ENABLE_DEFERRED_CALLBACK         0
+    // Enable timer-driven mode (a periodic timer interrupt runs the registered buttons, started by EXTI) if this macro is defined as 1.
+#define SIMPLEBTN_MODE_ENABLE_TIMER_DRIVEN              0
+    // Enable adaptive polling mode (idle dynamic-buttons are polled at a slow rate) if this macro is defined as 1.
+#define SIMPLEBTN_MODE_ENABLE_ADAPTIVE_POLLING          0
 
 /** @b ================================================================ **/
 /** @b Namespace */
@@ -131,6 +131,22 @@ typedef EXTITrigger_TypeDef simpleButton_Type_EXTITrigger_t;
 #define SIMPLEBTN_MODE_ENABLE_MULTI_THREADS             0
     // Enable long-push-hold mode if this macro is defined as 1.
 #define SIMPLEBTN_MODE_ENABLE_LONGPUSH_HOLD             0
+    // Enable adaptive-debounce mode (learn the bounce time of each button) if this macro is defined as 1.
+#define SIMPLEBTN_MODE_ENABLE_ADAPTIVE_DEBOUNCE         0
+    // Enable pressed/released event mode if this macro is defined as 1.
+#define SIMPLEBTN_MODE_ENABLE_PRESS_RELEASE_EVENT       0
+    // Enable registry mode (handle / init all buttons without listing them) if this macro is defined as 1.
+#define SIMPLEBTN_MODE_ENABLE_REGISTRY                  0
+    // Enable lock-free handoff mode (ISR and loop swap the state by CAS, no interrupt masking) if this macro is defined as 1.
+#define SIMPLEBTN_MODE_ENABLE_LOCKFREE_HANDOFF          0
+    // Enable snapshot mode (read the state of a button from any thread / ISR without critical section) if this macro is defined as 1.
+#define SIMPLEBTN_MODE_ENABLE_SNAPSHOT                  0
+    // Enable deferred callback mode (callbacks are queued and called by SimpleButton_Deferred_Drain()) if this macro is defined as 1.
+#define SIMPLEBTN_MODE_ENABLE_DEFERRED_CALLBACK         0
+    // Enable timer-driven mode (a periodic timer interrupt runs the registered buttons, started by EXTI) if this macro is defined as 1.
+#define SIMPLEBTN_MODE_ENABLE_TIMER_DRIVEN              0
+    // Enable adaptive polling mode (idle dynamic-buttons are polled at a slow rate) if this macro is defined as 1.
+#define SIMPLEBTN_MODE_ENABLE_ADAPTIVE_POLLING          0
 
 /** @b ================================================================ **/
 /** @b Namespace */
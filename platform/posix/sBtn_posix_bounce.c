@@ -0,0 +1,450 @@
+/**
+ * @file            sBtn_posix_bounce.c
+ *
+ * @author          Kim-J-Smith
+ *
+ * @brief           Source file of the stochastic contact-bounce model.
+ *
+ * @version         0.1.0 ( 0001L )
+ *
+ * @date            2025-10-03
+ *
+ * @attention       Copyright (c) 2025 Kim-J-Smith.
+ *                  All rights reserved.
+ *
+ * @copyright       SPDX-License-Identifier: MIT
+ *                  Refer to the LICENCE file in root for more details.
+ *                  <https://github.com/Kim-J-Smith/Simple-Button>
+ */
+#include    "sBtn_posix_bounce.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/* Phase of a simulated contact */
+#define SIMPLEBTN_BOUNCE_IDLE_      0U
+#define SIMPLEBTN_BOUNCE_PRESS_     1U
+#define SIMPLEBTN_BOUNCE_HELD_      2U
+#define SIMPLEBTN_BOUNCE_RELEASE_   3U
+
+#define SIMPLEBTN_BOUNCE_NEVER_     UINT64_MAX
+
+static uint32_t
+simpleButton_Bounce_Rand(SimpleButton_Type_BounceChannel_t* const ch)
+{
+    /* xorshift32 */
+    uint32_t x = ch->rand;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    ch->rand = x;
+    return x;
+}
+
+static uint64_t
+simpleButton_Bounce_Uniform(SimpleButton_Type_BounceChannel_t* const ch, uint32_t min, uint32_t max)
+{
+    if (max <= min) {
+        return min;
+    }
+    return (uint64_t)min + (simpleButton_Bounce_Rand(ch) % ((uint64_t)max - min + 1U));
+}
+
+/* Geometric distribution with the given mean, truncated at max */
+static uint8_t
+simpleButton_Bounce_Count(SimpleButton_Type_BounceChannel_t* const ch, uint8_t mean, uint8_t max)
+{
+    /* continue with p = mean / (mean + 1), in 1/65536 */
+    const uint32_t p = ((uint32_t)mean << 16) / ((uint32_t)mean + 1U);
+    uint8_t count = 0;
+
+    while (count < max && (simpleButton_Bounce_Rand(ch) & 0xFFFFU) < p) {
+        count ++;
+    }
+    return count;
+}
+
+/* Schedule the next contact event inside or after a burst */
+static void
+simpleButton_Bounce_Schedule(
+    const SimpleButton_Type_BounceConfig_t* const cfg,
+    SimpleButton_Type_BounceChannel_t* const ch,
+    uint64_t now
+) {
+    uint64_t slice;
+
+    if (ch->bounceLeft == 0) {
+        if (ch->phase == SIMPLEBTN_BOUNCE_PRESS_) {
+            ch->phase = SIMPLEBTN_BOUNCE_HELD_;
+            ch->nextContact_us = ch->releaseAt_us;
+        } else {
+            ch->phase = SIMPLEBTN_BOUNCE_IDLE_;
+            ch->nextContact_us = now + simpleButton_Bounce_Uniform(ch, cfg->gapMin_us, cfg->gapMax_us);
+        }
+        return;
+    }
+
+    /* every bounce is two edges, spread them over the rest of the burst */
+    slice = (ch->burstEnd_us > now) ? (ch->burstEnd_us - now) / (2U * ch->bounceLeft) : 1U;
+    ch->nextContact_us = now + simpleButton_Bounce_Uniform(ch, 1U, (uint32_t)(slice > 1U ? slice : 1U));
+}
+
+static void
+simpleButton_Bounce_ContactEvent(
+    SimpleButton_Type_BounceSim_t* const sim,
+    SimpleButton_Type_BounceChannel_t* const ch
+) {
+    const SimpleButton_Type_BounceConfig_t* const cfg = &(sim->config);
+    const uint64_t now = ch->nextContact_us;
+
+    switch (ch->phase) {
+    case SIMPLEBTN_BOUNCE_IDLE_: {
+        ch->contact = 1;
+        ch->phase = SIMPLEBTN_BOUNCE_PRESS_;
+        ch->bounceLeft = simpleButton_Bounce_Count(ch, cfg->pushBounceMean, cfg->pushBounceMax);
+        ch->burstEnd_us = now + simpleButton_Bounce_Uniform(ch, cfg->pushBurstMin_us, cfg->pushBurstMax_us);
+        ch->releaseAt_us = now + simpleButton_Bounce_Uniform(ch, cfg->holdMin_us, cfg->holdMax_us);
+        if (ch->releaseAt_us <= ch->burstEnd_us) {
+            ch->releaseAt_us = ch->burstEnd_us + 1U;
+        }
+        sim->stats.presses ++;
+        break;
+    }
+
+    case SIMPLEBTN_BOUNCE_PRESS_: {
+        ch->contact ^= 1U;
+        if (ch->contact != 0) {
+            ch->bounceLeft --;
+        }
+        break;
+    }
+
+    case SIMPLEBTN_BOUNCE_HELD_: {
+        ch->contact = 0;
+        ch->phase = SIMPLEBTN_BOUNCE_RELEASE_;
+        ch->bounceLeft = simpleButton_Bounce_Count(ch, cfg->releaseBounceMean, cfg->releaseBounceMax);
+        ch->burstEnd_us = now + simpleButton_Bounce_Uniform(ch, 0U, cfg->releaseBurstMax_us);
+        break;
+    }
+
+    default: { /* SIMPLEBTN_BOUNCE_RELEASE_ */
+        ch->contact ^= 1U;
+        if (ch->contact == 0) {
+            ch->bounceLeft --;
+        }
+        break;
+    }
+    } /* end switch */
+
+    simpleButton_Bounce_Schedule(cfg, ch, now);
+}
+
+static void
+simpleButton_Bounce_SpikeEvent(
+    SimpleButton_Type_BounceSim_t* const sim,
+    SimpleButton_Type_BounceChannel_t* const ch
+) {
+    const SimpleButton_Type_BounceConfig_t* const cfg = &(sim->config);
+    const uint64_t now = ch->nextSpike_us;
+
+    if (ch->spike == 0) {
+        ch->spike = 1;
+        ch->nextSpike_us = now + simpleButton_Bounce_Uniform(ch, 1U, cfg->emiWidthMax_us);
+        sim->stats.spikes ++;
+    } else {
+        ch->spike = 0;
+        ch->nextSpike_us = now + simpleButton_Bounce_Uniform(ch, 1U, 2U * cfg->emiInterval_us);
+    }
+}
+
+/* Time of the next event of a channel (contact or spike) */
+static uint64_t
+simpleButton_Bounce_NextEvent(const SimpleButton_Type_BounceChannel_t* const ch)
+{
+    return (ch->nextContact_us <= ch->nextSpike_us) ? ch->nextContact_us : ch->nextSpike_us;
+}
+
+/* Replay the edges of all the channels up to `until`, merged by timestamp */
+static void
+simpleButton_Bounce_Replay(
+    SimpleButton_Type_BounceSim_t* const sim,
+    uint64_t until
+) {
+    SimpleButton_Type_BounceChannel_t* ch;
+    uint8_t before, after;
+    uint64_t t, t0;
+    uint32_t i;
+
+    for (;;) {
+        /* the earliest event of all the channels, so the virtual time never goes back */
+        ch = 0;
+        t = until;
+        for (i = 0; i < sim->channelNum; i++) {
+            const uint64_t next = simpleButton_Bounce_NextEvent(&(sim->channels[i]));
+            if (next < t) {
+                t = next;
+                ch = &(sim->channels[i]);
+            }
+        }
+        if (ch == 0) {
+            break;
+        }
+
+        before = (uint8_t)(ch->contact ^ ch->spike);
+        if (ch->nextContact_us <= ch->nextSpike_us) {
+            simpleButton_Bounce_ContactEvent(sim, ch);
+        } else {
+            simpleButton_Bounce_SpikeEvent(sim, ch);
+        }
+        after = (uint8_t)(ch->contact ^ ch->spike);
+
+        if (before == after) {
+            continue; /* spike masked by the contact, no edge */
+        }
+
+        sim->stats.edges ++;
+        SimpleButton_Posix_SetTime(t);
+        SimpleButton_Posix_WritePin(
+            ch->base,
+            ch->pin,
+            (uint8_t)((after != 0) ? !(ch->normalPinVal) : ch->normalPinVal)
+        );
+
+        /* EXTI fires on every active-going edge */
+        if (after != 0 && ch->button != 0 && ch->button->Methods.interruptHandler != 0) {
+            t0 = SimpleButton_Posix_GetNs();
+            ch->button->Methods.interruptHandler();
+            sim->stats.isrNs += SimpleButton_Posix_GetNs() - t0;
+            sim->stats.isrCalls ++;
+        }
+    }
+}
+
+/**
+ * @brief           Fill the contact model with typical tactile-switch values.
+ *
+ * @param[out]      config - The config to fill.
+ *
+ * @return          None
+ */
+void
+SimpleButton_Bounce_DefaultConfig(
+    SimpleButton_Type_BounceConfig_t* const config
+) {
+    config->pushBurstMin_us = 300;
+    config->pushBurstMax_us = 5000;
+    config->pushBounceMean = 4;
+    config->pushBounceMax = 32;
+
+    config->releaseBurstMax_us = 3000;
+    config->releaseBounceMean = 2;
+    config->releaseBounceMax = 16;
+
+    config->holdMin_us = 60000;
+    config->holdMax_us = 400000;
+    config->gapMin_us = 200000;
+    config->gapMax_us = 2000000;
+
+    config->emiInterval_us = 0;
+    config->emiWidthMax_us = 20;
+}
+
+/**
+ * @brief           Initialize the simulator.
+ *
+ * @param[out]      sim - The simulator object.
+ * @param[in]       channels - Storage for `channelNum` channels.
+ * @param[in]       channelNum - Number of simulated buttons.
+ * @param[in]       config - The contact model (copied).
+ * @param[in]       seed - Seed of the random streams. (same seed, same edges)
+ *
+ * @return          None
+ *
+ * @note            Every channel must be bound to a button before running.
+ */
+void
+SimpleButton_Bounce_Init(
+    SimpleButton_Type_BounceSim_t* const sim,
+    SimpleButton_Type_BounceChannel_t* const channels,
+    uint32_t channelNum,
+    const SimpleButton_Type_BounceConfig_t* const config,
+    uint32_t seed
+) {
+    uint32_t i;
+    SimpleButton_Type_BounceChannel_t* ch;
+
+    sim->config = *config;
+    sim->channels = channels;
+    sim->channelNum = channelNum;
+    sim->now_us = 0;
+    sim->stats = (SimpleButton_Type_BounceStats_t){0};
+
+    for (i = 0; i < channelNum; i++) {
+        ch = &channels[i];
+        *ch = (SimpleButton_Type_BounceChannel_t){0};
+
+        /* independent stream per channel, never zero */
+        ch->rand = (seed ^ (0x9E3779B9U * (i + 1U))) | 1U;
+        ch->phase = SIMPLEBTN_BOUNCE_IDLE_;
+        ch->nextContact_us = simpleButton_Bounce_Uniform(ch, config->gapMin_us, config->gapMax_us);
+        ch->nextSpike_us = (config->emiInterval_us == 0) ? SIMPLEBTN_BOUNCE_NEVER_
+            : simpleButton_Bounce_Uniform(ch, 1U, 2U * config->emiInterval_us);
+    }
+}
+
+/**
+ * @brief           Bind a channel to an EXTI button created by SIMPLEBTN__CREATE().
+ *
+ * @param[inout]    sim - The simulator object.
+ * @param[in]       index - Index of the channel.
+ * @param[in]       button - The button object. (must be initialized)
+ * @param[in]       base - The simulated port used when creating the button.
+ * @param[in]       pin - The simulated pin used when creating the button.
+ * @param[in]       normalPinVal - Pin level when not pushed. (can be 1 or 0)
+ *
+ * @return          None
+ */
+void
+SimpleButton_Bounce_BindButton(
+    SimpleButton_Type_BounceSim_t* const sim,
+    uint32_t index,
+    simpleButton_Type_Button_t* const button,
+    simpleButton_Type_GPIOBase_t base,
+    simpleButton_Type_GPIOPin_t pin,
+    simpleButton_Type_GPIOPinVal_t normalPinVal
+) {
+    SimpleButton_Type_BounceChannel_t* const ch = &(sim->channels[index]);
+
+    ch->button = button;
+    ch->dynamicButton = 0;
+    ch->status = &(button->Private);
+    ch->base = base;
+    ch->pin = pin;
+    ch->normalPinVal = normalPinVal;
+    SimpleButton_Posix_WritePin(base, pin, normalPinVal);
+}
+
+/**
+ * @brief           Bind a channel to a dynamic button.
+ *
+ * @param[inout]    sim - The simulator object.
+ * @param[in]       index - Index of the channel.
+ * @param[in]       dynamicButton - The dynamic button object. (must be initialized)
+ *
+ * @return          None
+ */
+void
+SimpleButton_Bounce_BindDynamicButton(
+    SimpleButton_Type_BounceSim_t* const sim,
+    uint32_t index,
+    SimpleButton_Type_DynamicBtn_t* const dynamicButton
+) {
+    SimpleButton_Type_BounceChannel_t* const ch = &(sim->channels[index]);
+
+    ch->button = 0;
+    ch->dynamicButton = dynamicButton;
+    ch->status = &(dynamicButton->Private);
+    ch->base = dynamicButton->GPIO_Base;
+    ch->pin = dynamicButton->GPIO_Pin;
+    ch->normalPinVal = dynamicButton->normalPinVal;
+    SimpleButton_Posix_WritePin(ch->base, ch->pin, ch->normalPinVal);
+}
+
+/**
+ * @brief           Set the callback functions passed to the handler of a channel.
+ *
+ * @return          None
+ */
+void
+SimpleButton_Bounce_SetCallBack(
+    SimpleButton_Type_BounceSim_t* const sim,
+    uint32_t index,
+    simpleButton_Type_ShortPushCallBack_t shortPushCallBack,
+    simpleButton_Type_LongPushCallBack_t longPushCallBack,
+    simpleButton_Type_RepeatPushCallBack_t repeatPushCallBack
+) {
+    SimpleButton_Type_BounceChannel_t* const ch = &(sim->channels[index]);
+
+    ch->shortPushCallBack = shortPushCallBack;
+    ch->longPushCallBack = longPushCallBack;
+    ch->repeatPushCallBack = repeatPushCallBack;
+}
+
+/**
+ * @brief           Run the simulation on the virtual clock of the host port.
+ *
+ * @param[inout]    sim - The simulator object.
+ * @param[in]       duration_us - Simulated time to run.
+ * @param[in]       handlerPeriod_us - Period of the main loop, which calls
+ *                  the asynchronous handler of every button once.
+ *
+ * @return          None
+ *
+ * @note            Edges between two passes of the main loop are replayed
+ *                  in time order (of all the buttons) and raise the EXTI handler
+ *                  at their own timestamps. Results accumulate in `sim->stats`.
+ */
+void
+SimpleButton_Bounce_Run(
+    SimpleButton_Type_BounceSim_t* const sim,
+    uint64_t duration_us,
+    uint32_t handlerPeriod_us
+) {
+    const uint64_t end = sim->now_us + duration_us;
+    SimpleButton_Type_BounceChannel_t* ch;
+    simpleButton_Type_ButtonState_t before, after;
+    uint64_t t0;
+    uint32_t i;
+
+    SimpleButton_Posix_SetClock(SimpleButton_PosixClock_Virtual);
+
+    if (handlerPeriod_us == 0) {
+        handlerPeriod_us = 1000;
+    }
+
+    while (sim->now_us < end) {
+        sim->now_us += handlerPeriod_us;
+
+        simpleButton_Bounce_Replay(sim, sim->now_us);
+
+        SimpleButton_Posix_SetTime(sim->now_us);
+
+        t0 = SimpleButton_Posix_GetNs();
+        for (i = 0; i < sim->channelNum; i++) {
+            ch = &(sim->channels[i]);
+            before = (simpleButton_Type_ButtonState_t)(ch->status->state);
+
+            if (ch->dynamicButton != 0) {
+                SimpleButton_DynamicButton_Handler(
+                    ch->dynamicButton,
+                    ch->shortPushCallBack,
+                    ch->longPushCallBack,
+                    ch->repeatPushCallBack
+                );
+            } else {
+                ch->button->Methods.asynchronousHandler(
+                    ch->shortPushCallBack,
+                    ch->longPushCallBack,
+                    ch->repeatPushCallBack
+                );
+            }
+            sim->stats.handlerCalls ++;
+
+            after = (simpleButton_Type_ButtonState_t)(ch->status->state);
+            if (before == simpleButton_State_Push_Delay && after != before) {
+                if (after == simpleButton_State_Wait_For_Interrupt
+                    || after == simpleButton_State_Wait_For_Repeat) {
+                    sim->stats.pushRejected ++;
+                } else {
+                    sim->stats.pushConfirmed ++;
+                }
+            }
+        }
+        sim->stats.handlerNs += SimpleButton_Posix_GetNs() - t0;
+    }
+}
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
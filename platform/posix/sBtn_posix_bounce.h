@@ -0,0 +1,169 @@
+/**
+ * @file            sBtn_posix_bounce.h
+ *
+ * @author          Kim-J-Smith
+ *
+ * @brief           Header file of the stochastic contact-bounce model.
+ *                  It synthesizes realistic edge streams (press bounce,
+ *                  release chatter and EMI spikes) for many simulated
+ *                  buttons, and drives the interrupt and asynchronous
+ *                  handlers with them on the POSIX host.
+ *
+ * @version         0.1.0 ( 0001L )
+ *
+ * @date            2025-10-03
+ *
+ * @attention       Copyright (c) 2025 Kim-J-Smith.
+ *                  All rights reserved.
+ *
+ * @copyright       SPDX-License-Identifier: MIT
+ *                  Refer to the LICENCE file in root for more details.
+ *                  <https://github.com/Kim-J-Smith/Simple-Button>
+ */
+#ifndef     SIMPLEBUTTON_POSIX_BOUNCE_H__
+#define     SIMPLEBUTTON_POSIX_BOUNCE_H__   0001L
+
+#include    "Simple_Button.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/**
+ * @struct  SimpleButton_Type_BounceConfig_t
+ *
+ * @brief   Parameters of the contact model. All times are in microsecond.
+ *
+ * @note    The bounce counts follow a geometric distribution with the
+ *          given mean, truncated at the given maximum.
+ */
+typedef struct SimpleButton_Type_BounceConfig_t {
+
+    uint32_t    pushBurstMin_us;        /* shortest bounce burst after contact */
+    uint32_t    pushBurstMax_us;        /* longest bounce burst after contact */
+    uint8_t     pushBounceMean;         /* mean of the bounce count on press */
+    uint8_t     pushBounceMax;          /* maximum bounce count on press */
+
+    uint32_t    releaseBurstMax_us;     /* longest chatter burst on release */
+    uint8_t     releaseBounceMean;      /* mean of the chatter count on release */
+    uint8_t     releaseBounceMax;       /* maximum chatter count on release */
+
+    uint32_t    holdMin_us;             /* shortest press */
+    uint32_t    holdMax_us;             /* longest press */
+    uint32_t    gapMin_us;              /* shortest idle time between presses */
+    uint32_t    gapMax_us;              /* longest idle time between presses */
+
+    uint32_t    emiInterval_us;         /* mean interval of EMI spikes, 0 to disable */
+    uint32_t    emiWidthMax_us;         /* widest EMI spike */
+
+} SimpleButton_Type_BounceConfig_t;
+
+/* Statistics collected by SimpleButton_Bounce_Run() */
+typedef struct SimpleButton_Type_BounceStats_t {
+
+    uint64_t    edges;                  /* edges seen on the pins */
+    uint64_t    presses;                /* real presses synthesized */
+    uint64_t    spikes;                 /* EMI spikes synthesized */
+
+    uint64_t    isrCalls;               /* EXTI interrupts raised */
+    uint64_t    isrNs;                  /* CPU time spent in interrupt handlers */
+
+    uint64_t    handlerCalls;           /* asynchronous handler calls */
+    uint64_t    handlerNs;              /* CPU time spent in asynchronous handlers */
+
+    uint64_t    pushConfirmed;          /* Push_Delay --> Wait_For_End */
+    uint64_t    pushRejected;           /* Push_Delay --> false trigger */
+
+} SimpleButton_Type_BounceStats_t;
+
+/* One simulated contact, bound to one button. (internal use) */
+typedef struct SimpleButton_Type_BounceChannel_t {
+
+    simpleButton_Type_Button_t*         button;
+    SimpleButton_Type_DynamicBtn_t*     dynamicButton;
+    simpleButton_Type_PrivateBtnStatus_t* status;
+
+    simpleButton_Type_GPIOBase_t        base;
+    simpleButton_Type_GPIOPin_t         pin;
+    simpleButton_Type_GPIOPinVal_t      normalPinVal;
+
+    simpleButton_Type_ShortPushCallBack_t   shortPushCallBack;
+    simpleButton_Type_LongPushCallBack_t    longPushCallBack;
+    simpleButton_Type_RepeatPushCallBack_t  repeatPushCallBack;
+
+    uint32_t    rand;                   /* xorshift32 state */
+    uint8_t     phase;                  /* idle / press / held / release */
+    uint8_t     contact;                /* contact closed */
+    uint8_t     spike;                  /* EMI spike in progress */
+    uint8_t     bounceLeft;             /* bounces left in this burst */
+
+    uint64_t    nextContact_us;         /* next contact event */
+    uint64_t    burstEnd_us;            /* end of the current burst */
+    uint64_t    releaseAt_us;           /* end of the current press */
+    uint64_t    nextSpike_us;           /* next EMI event */
+
+} SimpleButton_Type_BounceChannel_t;
+
+/* The simulator: a group of channels sharing the same contact model. */
+typedef struct SimpleButton_Type_BounceSim_t {
+
+    SimpleButton_Type_BounceConfig_t    config;
+    SimpleButton_Type_BounceChannel_t*  channels;
+    uint32_t                            channelNum;
+    uint64_t                            now_us;
+    SimpleButton_Type_BounceStats_t     stats;
+
+} SimpleButton_Type_BounceSim_t;
+
+void
+SimpleButton_Bounce_DefaultConfig(
+    SimpleButton_Type_BounceConfig_t* const config
+);
+
+void
+SimpleButton_Bounce_Init(
+    SimpleButton_Type_BounceSim_t* const sim,
+    SimpleButton_Type_BounceChannel_t* const channels,
+    uint32_t channelNum,
+    const SimpleButton_Type_BounceConfig_t* const config,
+    uint32_t seed
+);
+
+void
+SimpleButton_Bounce_BindButton(
+    SimpleButton_Type_BounceSim_t* const sim,
+    uint32_t index,
+    simpleButton_Type_Button_t* const button,
+    simpleButton_Type_GPIOBase_t base,
+    simpleButton_Type_GPIOPin_t pin,
+    simpleButton_Type_GPIOPinVal_t normalPinVal
+);
+
+void
+SimpleButton_Bounce_BindDynamicButton(
+    SimpleButton_Type_BounceSim_t* const sim,
+    uint32_t index,
+    SimpleButton_Type_DynamicBtn_t* const dynamicButton
+);
+
+void
+SimpleButton_Bounce_SetCallBack(
+    SimpleButton_Type_BounceSim_t* const sim,
+    uint32_t index,
+    simpleButton_Type_ShortPushCallBack_t shortPushCallBack,
+    simpleButton_Type_LongPushCallBack_t longPushCallBack,
+    simpleButton_Type_RepeatPushCallBack_t repeatPushCallBack
+);
+
+void
+SimpleButton_Bounce_Run(
+    SimpleButton_Type_BounceSim_t* const sim,
+    uint64_t duration_us,
+    uint32_t handlerPeriod_us
+);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* SIMPLEBUTTON_POSIX_BOUNCE_H__ */
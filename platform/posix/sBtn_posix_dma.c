@@ -0,0 +1,106 @@
+/**
+ * @file            sBtn_posix_dma.c
+ *
+ * @author          Kim-J-Smith
+ *
+ * @brief           Source file of the host stand-in of the timer-triggered
+ *                  DMA sampling.
+ *
+ * @version         0.1.0 ( 0001L )
+ *
+ * @date            2025-10-03
+ *
+ * @attention       Copyright (c) 2025 Kim-J-Smith.
+ *                  All rights reserved.
+ *
+ * @copyright       SPDX-License-Identifier: MIT
+ *                  Refer to the LICENCE file in root for more details.
+ *                  <https://github.com/Kim-J-Smith/Simple-Button>
+ */
+#include    "sBtn_posix_dma.h"
+#include    "sBtn_posix_port.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/* The running "DMA channels" (one scanner at a time, like one timer) */
+static SimpleButton_Type_DmaScanner_t*      g_posix_dma_scanner = 0;
+static const SimpleButton_Type_DmaPort_t*   g_posix_dma_ports = 0;
+static volatile uint16_t*                   g_posix_dma_buffer = 0;
+static uint16_t                             g_posix_dma_depth = 0;
+static uint16_t                             g_posix_dma_index = 0;
+static uint8_t                              g_posix_dma_port_count = 0;
+static uint32_t                             g_posix_dma_samples = 0;
+
+static void simpleButton_Posix_DmaHalfIRQ(void)
+{
+    SimpleButton_DmaScan_TransferEvent(g_posix_dma_scanner, 0);
+}
+
+static void simpleButton_Posix_DmaFullIRQ(void)
+{
+    SimpleButton_DmaScan_TransferEvent(g_posix_dma_scanner, 1);
+}
+
+void
+SimpleButton_Posix_DmaStart(
+    void* context,
+    const SimpleButton_Type_DmaPort_t* ports,
+    uint8_t portCount,
+    volatile uint16_t* buffer,
+    uint16_t depth
+) {
+    g_posix_dma_scanner = (SimpleButton_Type_DmaScanner_t*)context;
+    g_posix_dma_ports = ports;
+    g_posix_dma_buffer = buffer;
+    g_posix_dma_depth = depth;
+    g_posix_dma_index = 0;
+    g_posix_dma_port_count = portCount;
+    g_posix_dma_samples = 0;
+}
+
+void
+SimpleButton_Posix_DmaStop(void* context)
+{
+    (void)context;
+    g_posix_dma_scanner = 0;
+}
+
+/**
+ * @brief   Simulate `count` timer triggers. Each one copies every port into
+ *          its channel, and the half / full transfer events are raised by
+ *          `SimpleButton_Posix_RaiseIRQ()`, like the DMA of port 0 does.
+ */
+void
+SimpleButton_Posix_DmaTrigger(uint32_t count)
+{
+    while (count != 0 && g_posix_dma_scanner != 0) {
+        uint8_t port;
+
+        for (port = 0; port < g_posix_dma_port_count; port++) {
+            g_posix_dma_buffer[(uint32_t)port * g_posix_dma_depth + g_posix_dma_index] =
+                SimpleButton_Posix_ReadPort((uint32_t)g_posix_dma_ports[port].GPIO_Base);
+        }
+
+        g_posix_dma_samples ++;
+        count --;
+
+        if (++ g_posix_dma_index == g_posix_dma_depth / 2U) {
+            SimpleButton_Posix_RaiseIRQ(simpleButton_Posix_DmaHalfIRQ);
+        } else if (g_posix_dma_index == g_posix_dma_depth) {
+            g_posix_dma_index = 0;
+            SimpleButton_Posix_RaiseIRQ(simpleButton_Posix_DmaFullIRQ);
+        }
+    }
+}
+
+uint32_t
+SimpleButton_Posix_DmaGetSamples(void)
+{
+    return g_posix_dma_samples;
+}
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
@@ -0,0 +1,58 @@
+/**
+ * @file            sBtn_posix_dma.h
+ *
+ * @author          Kim-J-Smith
+ *
+ * @brief           Header file of the host stand-in of the timer-triggered DMA
+ *                  sampling (see "sBtn_dma.h"). Each trigger copies the
+ *                  simulated GPIO ports into the circular buffer, and the
+ *                  half / full transfer events are raised as interrupts, so
+ *                  the batch path can be tested and measured on the host.
+ *
+ * @version         0.1.0 ( 0001L )
+ *
+ * @date            2025-10-03
+ *
+ * @attention       Copyright (c) 2025 Kim-J-Smith.
+ *                  All rights reserved.
+ *
+ * @copyright       SPDX-License-Identifier: MIT
+ *                  Refer to the LICENCE file in root for more details.
+ *                  <https://github.com/Kim-J-Smith/Simple-Button>
+ */
+#ifndef     SIMPLEBUTTON_POSIX_DMA_H__
+#define     SIMPLEBUTTON_POSIX_DMA_H__      0001L
+
+#include    "sBtn_dma.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/* Start hook : `context` is the `SimpleButton_Type_DmaScanner_t*`. Only one scanner at a time. */
+void
+SimpleButton_Posix_DmaStart(
+    void* context,
+    const SimpleButton_Type_DmaPort_t* ports,
+    uint8_t portCount,
+    volatile uint16_t* buffer,
+    uint16_t depth
+);
+
+/* Stop hook */
+void
+SimpleButton_Posix_DmaStop(void* context);
+
+/* Simulate `count` timer triggers : sample the ports, raise the transfer events. */
+void
+SimpleButton_Posix_DmaTrigger(uint32_t count);
+
+/* The number of samples of each port since the start */
+uint32_t
+SimpleButton_Posix_DmaGetSamples(void);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* SIMPLEBUTTON_POSIX_DMA_H__ */
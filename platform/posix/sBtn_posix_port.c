@@ -0,0 +1,516 @@
+/**
+ * @file            sBtn_posix_port.c
+ *
+ * @author          Kim-J-Smith
+ *
+ * @brief           Source file to define the POSIX host port APIs.
+ *
+ * @version         0.1.0 ( 0001L )
+ *
+ * @date            2025-10-03
+ *
+ * @attention       Copyright (c) 2025 Kim-J-Smith.
+ *                  All rights reserved.
+ *
+ * @copyright       SPDX-License-Identifier: MIT
+ *                  Refer to the LICENCE file in root for more details.
+ *                  <https://github.com/Kim-J-Smith/Simple-Button>
+ */
+#if !defined(_POSIX_C_SOURCE) || (_POSIX_C_SOURCE < 200809L)
+ #undef  _POSIX_C_SOURCE
+ #define _POSIX_C_SOURCE 200809L
+#endif /* _POSIX_C_SOURCE */
+#if !defined(_XOPEN_SOURCE) || (_XOPEN_SOURCE < 700)
+ #undef  _XOPEN_SOURCE
+ #define _XOPEN_SOURCE 700
+#endif /* _XOPEN_SOURCE */
+
+#include    "sBtn_posix_port.h"
+#include    <pthread.h>
+#include    <sched.h>
+#include    <time.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/* Simulated input data registers */
+static uint16_t g_posix_port[SIMPLEBTN_POSIX_PORT_NUM];
+
+/* Simulated ADC data registers */
+static uint16_t g_posix_adc[SIMPLEBTN_POSIX_ADC_NUM];
+
+/* Simulated GPIO expander bus */
+static uint32_t g_posix_expander_latency_us = 0;
+static uint32_t g_posix_expander_reads = 0;
+
+/* Simulated 74HC165 chain : parallel inputs and the shift register */
+static uint8_t g_posix_shiftreg_input[SIMPLEBTN_POSIX_SHIFTREG_BITS / 8];
+static uint8_t g_posix_shiftreg[SIMPLEBTN_POSIX_SHIFTREG_BITS / 8];
+static uint16_t g_posix_shiftreg_pos = 0;
+
+/* Tick source */
+static SimpleButton_Type_PosixClock_t g_posix_clock = SimpleButton_PosixClock_Monotonic;
+static uint64_t g_posix_virtual_us = 0;
+
+/* The lock which plays the role of `__disable_irq()` */
+static pthread_mutex_t g_posix_lock;
+static pthread_once_t g_posix_lock_once = PTHREAD_ONCE_INIT;
+
+/* The lock of the shard handled by this thread, instead of the global one */
+static __thread pthread_mutex_t* g_posix_thread_lock = 0;
+
+/* Critical sections taken by the library (the time interrupts would be masked) */
+static uint32_t g_posix_masked_depth = 0;
+static uint32_t g_posix_masked_count = 0;
+static uint64_t g_posix_masked_begin_ns = 0;
+static uint64_t g_posix_masked_max_ns = 0;
+static uint8_t g_posix_masked_timing = 0; /* timed only after a reset, reading the clock is not free */
+
+/* Simulated low priority software interrupt (PendSV) */
+static pthread_t g_posix_softirq_thread;
+static pthread_mutex_t g_posix_softirq_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t g_posix_softirq_cond = PTHREAD_COND_INITIALIZER;
+static void (* volatile g_posix_softirq_handler)(void) = 0;
+static uint8_t g_posix_softirq_pending = 0;
+static uint8_t g_posix_softirq_running = 0;
+
+/* Simulated periodic timer interrupt */
+static pthread_t g_posix_timer_thread;
+static pthread_mutex_t g_posix_timer_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t g_posix_timer_cond = PTHREAD_COND_INITIALIZER;
+static void (* g_posix_timer_isr)(void) = 0;
+static uint32_t g_posix_timer_period_ms = 1;
+static uint32_t g_posix_timer_ticks = 0;
+static uint8_t g_posix_timer_running = 0;
+static uint8_t g_posix_timer_created = 0;
+
+static void simpleButton_Posix_InitLock(void)
+{
+    pthread_mutexattr_t attr;
+    pthread_mutexattr_init(&attr);
+    pthread_mutexattr_settype(&attr, PTHREAD_MUTEX_RECURSIVE);
+    pthread_mutex_init(&g_posix_lock, &attr);
+    pthread_mutexattr_destroy(&attr);
+}
+
+uint8_t SimpleButton_Posix_ReadPin(uint32_t port, uint16_t pin)
+{
+    if (port >= SIMPLEBTN_POSIX_PORT_NUM) {
+        return 0;
+    }
+    return (uint8_t)((__atomic_load_n(&g_posix_port[port], __ATOMIC_ACQUIRE) & pin) != 0);
+}
+
+uint16_t SimpleButton_Posix_ReadPort(uint32_t port)
+{
+    if (port >= SIMPLEBTN_POSIX_PORT_NUM) {
+        return 0;
+    }
+    return __atomic_load_n(&g_posix_port[port], __ATOMIC_ACQUIRE);
+}
+
+void SimpleButton_Posix_WritePin(uint32_t port, uint16_t pin, uint8_t level)
+{
+    if (port >= SIMPLEBTN_POSIX_PORT_NUM) {
+        return;
+    }
+    if (level != 0) {
+        __atomic_fetch_or(&g_posix_port[port], pin, __ATOMIC_RELEASE);
+    } else {
+        __atomic_fetch_and(&g_posix_port[port], (uint16_t)~pin, __ATOMIC_RELEASE);
+    }
+}
+
+uint16_t SimpleButton_Posix_ReadAdc(uint32_t channel)
+{
+    if (channel >= SIMPLEBTN_POSIX_ADC_NUM) {
+        return 0;
+    }
+    return __atomic_load_n(&g_posix_adc[channel], __ATOMIC_ACQUIRE);
+}
+
+void SimpleButton_Posix_WriteAdc(uint32_t channel, uint16_t value)
+{
+    if (channel >= SIMPLEBTN_POSIX_ADC_NUM) {
+        return;
+    }
+    __atomic_store_n(&g_posix_adc[channel], value, __ATOMIC_RELEASE);
+}
+
+/**
+ * @brief   Read the 16 inputs of an expander as one bus transaction.
+ *          The inputs are the pins of the simulated `port`, and each read
+ *          busy-waits for the configured bus latency.
+ */
+uint16_t SimpleButton_Posix_ReadExpander(uint32_t port)
+{
+    const uint32_t latency_us = __atomic_load_n(&g_posix_expander_latency_us, __ATOMIC_RELAXED);
+
+    __atomic_fetch_add(&g_posix_expander_reads, 1U, __ATOMIC_RELAXED);
+
+    if (latency_us != 0) {
+        const uint64_t end = SimpleButton_Posix_GetNs() + (uint64_t)latency_us * 1000U;
+        while (SimpleButton_Posix_GetNs() < end) {
+            /* the bus is busy */
+        }
+    }
+
+    return SimpleButton_Posix_ReadPort(port);
+}
+
+void SimpleButton_Posix_SetExpanderLatency(uint32_t latency_us)
+{
+    __atomic_store_n(&g_posix_expander_latency_us, latency_us, __ATOMIC_RELAXED);
+}
+
+uint32_t SimpleButton_Posix_GetExpanderReadCount(void)
+{
+    return __atomic_load_n(&g_posix_expander_reads, __ATOMIC_RELAXED);
+}
+
+void SimpleButton_Posix_WriteShiftRegInput(uint16_t input, uint8_t level)
+{
+    if (input >= SIMPLEBTN_POSIX_SHIFTREG_BITS) {
+        return;
+    }
+    if (level != 0) {
+        __atomic_fetch_or(&g_posix_shiftreg_input[input / 8], (uint8_t)(0x80U >> (input % 8)), __ATOMIC_RELEASE);
+    } else {
+        __atomic_fetch_and(&g_posix_shiftreg_input[input / 8], (uint8_t)~(0x80U >> (input % 8)), __ATOMIC_RELEASE);
+    }
+}
+
+void SimpleButton_Posix_ShiftRegLoad(void)
+{
+    uint16_t i;
+    for (i = 0; i < SIMPLEBTN_POSIX_SHIFTREG_BITS / 8; i++) {
+        g_posix_shiftreg[i] = __atomic_load_n(&g_posix_shiftreg_input[i], __ATOMIC_ACQUIRE);
+    }
+    g_posix_shiftreg_pos = 0;
+}
+
+uint8_t SimpleButton_Posix_ShiftRegReadData(void)
+{
+    if (g_posix_shiftreg_pos >= SIMPLEBTN_POSIX_SHIFTREG_BITS) {
+        return 0; /* the serial input (DS) of the last register is tied low */
+    }
+    return (uint8_t)((g_posix_shiftreg[g_posix_shiftreg_pos / 8] >> (7 - g_posix_shiftreg_pos % 8)) & 1U);
+}
+
+void SimpleButton_Posix_ShiftRegClock(void)
+{
+    g_posix_shiftreg_pos ++;
+}
+
+void SimpleButton_Posix_ShiftRegBurst(uint8_t* buffer, uint16_t bytes)
+{
+    uint16_t i;
+    for (i = 0; i < bytes; i++) {
+        const uint16_t byte = (uint16_t)(g_posix_shiftreg_pos / 8);
+        buffer[i] = (byte < SIMPLEBTN_POSIX_SHIFTREG_BITS / 8) ? g_posix_shiftreg[byte] : 0;
+        g_posix_shiftreg_pos = (uint16_t)(g_posix_shiftreg_pos + 8);
+    }
+}
+
+void SimpleButton_Posix_SetClock(SimpleButton_Type_PosixClock_t clock)
+{
+    g_posix_clock = clock;
+}
+
+void SimpleButton_Posix_SetTime(uint64_t time_us)
+{
+    __atomic_store_n(&g_posix_virtual_us, time_us, __ATOMIC_RELEASE);
+}
+
+uint64_t SimpleButton_Posix_GetTimeUs(void)
+{
+    struct timespec ts;
+
+    if (g_posix_clock == SimpleButton_PosixClock_Virtual) {
+        return __atomic_load_n(&g_posix_virtual_us, __ATOMIC_ACQUIRE);
+    }
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000U + (uint64_t)ts.tv_nsec / 1000U;
+}
+
+uint32_t SimpleButton_Posix_GetTick(void)
+{
+    return (uint32_t)(SimpleButton_Posix_GetTimeUs() / 1000U);
+}
+
+/**
+ * @brief   Monotonic wall-clock time in nanosecond, independent of the
+ *          tick source. Used to measure the cost of the handlers.
+ */
+uint64_t SimpleButton_Posix_GetNs(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000U + (uint64_t)ts.tv_nsec;
+}
+
+/**
+ * @brief   Call `func(arg)` `iterations` times and return the mean cost of
+ *          one call in nanosecond. Used to compare the scan engines.
+ */
+uint64_t SimpleButton_Posix_MeasureNs(void (* func)(void* arg), void* arg, uint32_t iterations)
+{
+    uint64_t begin;
+    uint32_t i;
+
+    if (iterations == 0) {
+        return 0;
+    }
+
+    func(arg); /* warm up the cache */
+
+    begin = SimpleButton_Posix_GetNs();
+    for (i = 0; i < iterations; i++) {
+        func(arg);
+    }
+
+    return (SimpleButton_Posix_GetNs() - begin) / iterations;
+}
+
+void SimpleButton_Posix_CriticalSectionBegin(void)
+{
+    if (g_posix_thread_lock != 0) {
+        pthread_mutex_lock(g_posix_thread_lock);
+        return;
+    }
+
+    pthread_once(&g_posix_lock_once, simpleButton_Posix_InitLock);
+    pthread_mutex_lock(&g_posix_lock);
+
+    if (g_posix_masked_depth ++ == 0) {
+        g_posix_masked_count ++;
+        if (g_posix_masked_timing) {
+            g_posix_masked_begin_ns = SimpleButton_Posix_GetNs();
+        }
+    }
+}
+
+void SimpleButton_Posix_CriticalSectionEnd(void)
+{
+    if (g_posix_thread_lock != 0) {
+        pthread_mutex_unlock(g_posix_thread_lock);
+        return;
+    }
+
+    if (-- g_posix_masked_depth == 0 && g_posix_masked_timing) {
+        const uint64_t masked_ns = SimpleButton_Posix_GetNs() - g_posix_masked_begin_ns;
+        if (masked_ns > g_posix_masked_max_ns) {
+            g_posix_masked_max_ns = masked_ns;
+        }
+    }
+
+    pthread_mutex_unlock(&g_posix_lock);
+}
+
+/**
+ * @brief   Let the critical sections of this thread take `lock` (a recursive
+ *          mutex) instead of the global one, 0 to restore.
+ */
+void SimpleButton_Posix_SetThreadLock(pthread_mutex_t* lock)
+{
+    g_posix_thread_lock = lock;
+}
+
+/**
+ * @brief   The number of critical sections, and the longest one, since the
+ *          last reset (the first reset turns the timing on). On the MCU,
+ *          every one of them is IRQ latency.
+ */
+void SimpleButton_Posix_ResetMaskedStats(void)
+{
+    g_posix_masked_count = 0;
+    g_posix_masked_max_ns = 0;
+    g_posix_masked_timing = 1;
+}
+
+uint32_t SimpleButton_Posix_GetMaskedCount(void)
+{
+    return g_posix_masked_count;
+}
+
+uint64_t SimpleButton_Posix_GetMaskedMaxNs(void)
+{
+    return g_posix_masked_max_ns;
+}
+
+/**
+ * @brief   Run `isr` the way the MCU would run an EXTI interrupt:
+ *          never in the middle of a critical section. (not of the threads
+ *          which took their own lock, see `SimpleButton_Shard_RaiseIRQ()`)
+ */
+void SimpleButton_Posix_RaiseIRQ(void (* isr)(void))
+{
+    pthread_once(&g_posix_lock_once, simpleButton_Posix_InitLock);
+    pthread_mutex_lock(&g_posix_lock); /* the ISR itself is not a masked section */
+    isr();
+    pthread_mutex_unlock(&g_posix_lock);
+}
+
+void SimpleButton_Posix_LowPower(void)
+{
+    sched_yield();
+}
+
+static void* simpleButton_Posix_SoftIRQThread(void* arg)
+{
+    (void)arg;
+
+    pthread_mutex_lock(&g_posix_softirq_lock);
+    while (g_posix_softirq_handler != 0) {
+        if (!g_posix_softirq_pending) {
+            pthread_cond_wait(&g_posix_softirq_cond, &g_posix_softirq_lock);
+            continue;
+        }
+        g_posix_softirq_pending = 0;
+
+        /* the handler runs outside of every lock, like a lowest priority IRQ */
+        pthread_mutex_unlock(&g_posix_softirq_lock);
+        g_posix_softirq_handler();
+        pthread_mutex_lock(&g_posix_softirq_lock);
+    }
+    pthread_mutex_unlock(&g_posix_softirq_lock);
+
+    return 0;
+}
+
+/**
+ * @brief   Start a thread which plays the role of a low priority software
+ *          interrupt (PendSV): `handler` runs once after each
+ *          `SimpleButton_Posix_PendSoftIRQ()` (pends while it runs are merged).
+ *          0 to stop the thread. Call it from the main thread only.
+ */
+void SimpleButton_Posix_SetSoftIRQ(void (* handler)(void))
+{
+    if (g_posix_softirq_running) {
+        pthread_mutex_lock(&g_posix_softirq_lock);
+        g_posix_softirq_handler = 0;
+        pthread_cond_signal(&g_posix_softirq_cond);
+        pthread_mutex_unlock(&g_posix_softirq_lock);
+        pthread_join(g_posix_softirq_thread, 0);
+        g_posix_softirq_running = 0;
+    }
+
+    if (handler == 0) {
+        return;
+    }
+
+    g_posix_softirq_handler = handler;
+    g_posix_softirq_pending = 0;
+    if (pthread_create(&g_posix_softirq_thread, 0, simpleButton_Posix_SoftIRQThread, 0) == 0) {
+        g_posix_softirq_running = 1;
+    } else {
+        g_posix_softirq_handler = 0;
+    }
+}
+
+/**
+ * @brief   Pend the software interrupt. Safe in callbacks and critical sections.
+ */
+void SimpleButton_Posix_PendSoftIRQ(void)
+{
+    pthread_mutex_lock(&g_posix_softirq_lock);
+    g_posix_softirq_pending = 1;
+    pthread_cond_signal(&g_posix_softirq_cond);
+    pthread_mutex_unlock(&g_posix_softirq_lock);
+}
+
+static void* simpleButton_Posix_TimerThread(void* arg)
+{
+    struct timespec next;
+    (void)arg;
+
+    clock_gettime(CLOCK_MONOTONIC, &next);
+
+    pthread_mutex_lock(&g_posix_timer_lock);
+    for (;;) {
+        void (* isr)(void);
+
+        if (!g_posix_timer_running) {
+            pthread_cond_wait(&g_posix_timer_cond, &g_posix_timer_lock);
+            clock_gettime(CLOCK_MONOTONIC, &next); /* (re)started : the first period begins now */
+            continue;
+        }
+
+        next.tv_nsec += (long)g_posix_timer_period_ms * 1000000L;
+        while (next.tv_nsec >= 1000000000L) {
+            next.tv_nsec -= 1000000000L;
+            next.tv_sec ++;
+        }
+        pthread_mutex_unlock(&g_posix_timer_lock);
+
+        /* absolute deadlines, so the period does not drift with the ISR time */
+        while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &next, 0) != 0) {}
+
+        pthread_mutex_lock(&g_posix_timer_lock);
+        if (!g_posix_timer_running) {
+            continue; /* stopped while sleeping */
+        }
+        g_posix_timer_ticks ++;
+        isr = g_posix_timer_isr;
+        pthread_mutex_unlock(&g_posix_timer_lock);
+
+        SimpleButton_Posix_RaiseIRQ(isr); /* the ISR may stop the timer */
+
+        pthread_mutex_lock(&g_posix_timer_lock);
+    }
+
+    return 0;
+}
+
+/**
+ * @brief   Start a periodic timer interrupt : `isr` runs every `periodMs`
+ *          (real time, like `SimpleButton_Posix_RaiseIRQ()`), until
+ *          `SimpleButton_Posix_StopTimer()`. Safe in ISRs and critical sections.
+ *          Called again while it runs, the new period starts at the next interrupt.
+ */
+void SimpleButton_Posix_StartTimer(void (* isr)(void), uint32_t periodMs)
+{
+    pthread_mutex_lock(&g_posix_timer_lock);
+
+    if (!g_posix_timer_created) {
+        if (pthread_create(&g_posix_timer_thread, 0, simpleButton_Posix_TimerThread, 0) != 0) {
+            pthread_mutex_unlock(&g_posix_timer_lock);
+            return;
+        }
+        pthread_detach(g_posix_timer_thread);
+        g_posix_timer_created = 1;
+    }
+
+    g_posix_timer_isr = isr;
+    g_posix_timer_period_ms = (periodMs != 0) ? periodMs : 1U;
+    if (!g_posix_timer_running) {
+        g_posix_timer_running = 1;
+        pthread_cond_signal(&g_posix_timer_cond);
+    }
+
+    pthread_mutex_unlock(&g_posix_timer_lock);
+}
+
+/**
+ * @brief   Stop the periodic timer interrupt. Safe in its own ISR.
+ */
+void SimpleButton_Posix_StopTimer(void)
+{
+    pthread_mutex_lock(&g_posix_timer_lock);
+    g_posix_timer_running = 0;
+    pthread_mutex_unlock(&g_posix_timer_lock);
+}
+
+/**
+ * @brief   The number of periodic timer interrupts so far.
+ */
+uint32_t SimpleButton_Posix_GetTimerTicks(void)
+{
+    return g_posix_timer_ticks;
+}
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
@@ -0,0 +1,106 @@
+/**
+ * @file            sBtn_posix_port.h
+ *
+ * @author          Kim-J-Smith
+ *
+ * @brief           Header file to declare the POSIX host port APIs:
+ *                  simulated GPIO ports, ADC channels, GPIO expanders,
+ *                  74HC165 chain, tick source, critical section
+ *                  (global, or per shard of buttons), software interrupt
+ *                  and periodic timer interrupt.
+ *
+ * @version         0.1.0 ( 0001L )
+ *
+ * @date            2025-10-03
+ *
+ * @attention       Copyright (c) 2025 Kim-J-Smith.
+ *                  All rights reserved.
+ *
+ * @copyright       SPDX-License-Identifier: MIT
+ *                  Refer to the LICENCE file in root for more details.
+ *                  <https://github.com/Kim-J-Smith/Simple-Button>
+ */
+#ifndef     SIMPLEBUTTON_POSIX_PORT_H__
+#define     SIMPLEBUTTON_POSIX_PORT_H__     0001L
+
+#include    <stdint.h>
+#include    <pthread.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/* Number of simulated 16-pin GPIO ports */
+#ifndef SIMPLEBTN_POSIX_PORT_NUM
+ #define SIMPLEBTN_POSIX_PORT_NUM           256
+#endif /* SIMPLEBTN_POSIX_PORT_NUM */
+
+/* Number of bits of the simulated 74HC165 chain */
+#ifndef SIMPLEBTN_POSIX_SHIFTREG_BITS
+ #define SIMPLEBTN_POSIX_SHIFTREG_BITS      256
+#endif /* SIMPLEBTN_POSIX_SHIFTREG_BITS */
+
+/* Number of simulated ADC channels */
+#ifndef SIMPLEBTN_POSIX_ADC_NUM
+ #define SIMPLEBTN_POSIX_ADC_NUM            16
+#endif /* SIMPLEBTN_POSIX_ADC_NUM */
+
+/* Simulated EXTI trigger */
+#define SIMPLEBTN_POSIX_TRIGGER_FALLING     0U
+#define SIMPLEBTN_POSIX_TRIGGER_RISING      1U
+
+/* Tick source of the host port */
+typedef enum SimpleButton_Type_PosixClock_t {
+    SimpleButton_PosixClock_Monotonic = 0,  /* CLOCK_MONOTONIC */
+    SimpleButton_PosixClock_Virtual,        /* driven by SimpleButton_Posix_SetTime() */
+} SimpleButton_Type_PosixClock_t;
+
+/* Simulated GPIO */
+uint8_t SimpleButton_Posix_ReadPin(uint32_t port, uint16_t pin);
+uint16_t SimpleButton_Posix_ReadPort(uint32_t port);
+void SimpleButton_Posix_WritePin(uint32_t port, uint16_t pin, uint8_t level);
+
+/* Simulated ADC */
+uint16_t SimpleButton_Posix_ReadAdc(uint32_t channel);
+void SimpleButton_Posix_WriteAdc(uint32_t channel, uint16_t value);
+
+/* Simulated I2C/SPI GPIO expander, backed by a simulated port */
+uint16_t SimpleButton_Posix_ReadExpander(uint32_t port);
+void SimpleButton_Posix_SetExpanderLatency(uint32_t latency_us);
+uint32_t SimpleButton_Posix_GetExpanderReadCount(void);
+
+/* Simulated 74HC165 chain, input N is the N-th bit shifted out */
+void SimpleButton_Posix_WriteShiftRegInput(uint16_t input, uint8_t level);
+void SimpleButton_Posix_ShiftRegLoad(void);
+uint8_t SimpleButton_Posix_ShiftRegReadData(void);
+void SimpleButton_Posix_ShiftRegClock(void);
+void SimpleButton_Posix_ShiftRegBurst(uint8_t* buffer, uint16_t bytes);
+
+/* Time */
+void SimpleButton_Posix_SetClock(SimpleButton_Type_PosixClock_t clock);
+void SimpleButton_Posix_SetTime(uint64_t time_us);
+uint64_t SimpleButton_Posix_GetTimeUs(void);
+uint32_t SimpleButton_Posix_GetTick(void);
+uint64_t SimpleButton_Posix_GetNs(void);
+uint64_t SimpleButton_Posix_MeasureNs(void (* func)(void* arg), void* arg, uint32_t iterations);
+
+/* Critical section and simulated interrupt */
+void SimpleButton_Posix_CriticalSectionBegin(void);
+void SimpleButton_Posix_CriticalSectionEnd(void);
+void SimpleButton_Posix_SetThreadLock(pthread_mutex_t* lock);
+void SimpleButton_Posix_ResetMaskedStats(void);
+uint32_t SimpleButton_Posix_GetMaskedCount(void);
+uint64_t SimpleButton_Posix_GetMaskedMaxNs(void);
+void SimpleButton_Posix_RaiseIRQ(void (* isr)(void));
+void SimpleButton_Posix_LowPower(void);
+void SimpleButton_Posix_SetSoftIRQ(void (* handler)(void));
+void SimpleButton_Posix_PendSoftIRQ(void);
+void SimpleButton_Posix_StartTimer(void (* isr)(void), uint32_t periodMs);
+void SimpleButton_Posix_StopTimer(void);
+uint32_t SimpleButton_Posix_GetTimerTicks(void);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* SIMPLEBUTTON_POSIX_PORT_H__ */
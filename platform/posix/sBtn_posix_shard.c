@@ -0,0 +1,369 @@
+/**
+ * @file            sBtn_posix_shard.c
+ *
+ * @author          Kim-J-Smith
+ *
+ * @brief           Source file of the sharded poller.
+ *
+ * @version         0.1.0 ( 0001L )
+ *
+ * @date            2025-10-03
+ *
+ * @attention       Copyright (c) 2025 Kim-J-Smith.
+ *                  All rights reserved.
+ *
+ * @copyright       SPDX-License-Identifier: MIT
+ *                  Refer to the LICENCE file in root for more details.
+ *                  <https://github.com/Kim-J-Smith/Simple-Button>
+ */
+#if !defined(_POSIX_C_SOURCE) || (_POSIX_C_SOURCE < 200809L)
+ #undef  _POSIX_C_SOURCE
+ #define _POSIX_C_SOURCE 200809L
+#endif /* _POSIX_C_SOURCE */
+#if !defined(_XOPEN_SOURCE) || (_XOPEN_SOURCE < 700)
+ #undef  _XOPEN_SOURCE
+ #define _XOPEN_SOURCE 700
+#endif /* _XOPEN_SOURCE */
+
+#include    "sBtn_posix_shard.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/* The button whose callback is running in this thread */
+static __thread uint32_t g_shard_current_button = 0;
+
+/* Collect the pins of the shard port by port, for the idle check */
+static void
+simpleButton_Shard_BuildGroups(SimpleButton_Type_Shard_t* const shard)
+{
+    uint32_t i;
+
+    shard->groupCount = 0;
+
+    for (i = 0; i < shard->count; i++) {
+        const SimpleButton_Type_DynamicBtn_t* const btn = &(shard->buttons[i]);
+        SimpleButton_Type_ShardGroup_t* group = 0;
+        uint32_t g;
+
+        for (g = 0; g < shard->groupCount; g++) {
+            if (shard->groups[g].port == (uint32_t)btn->GPIO_Base) {
+                group = &(shard->groups[g]);
+                break;
+            }
+        }
+
+        if (group == 0) {
+            if (shard->groupCount >= SIMPLEBTN_POSIX_SHARD_MAX_GROUPS) {
+                shard->groupCount = 0; /* too scattered, never skip it */
+                return;
+            }
+            group = &(shard->groups[shard->groupCount ++]);
+            group->port = (uint32_t)btn->GPIO_Base;
+            group->mask = 0;
+            group->idle = 0;
+        }
+
+        group->mask |= btn->GPIO_Pin;
+        if (btn->normalPinVal != 0) {
+            group->idle |= btn->GPIO_Pin;
+        }
+    }
+}
+
+/* Non-zero if no button of the idle shard is pushed now, or taken by an interrupt since the last pass (shard lock held) */
+static uint8_t
+simpleButton_Shard_CanSkip(const SimpleButton_Type_Shard_t* const shard)
+{
+    uint32_t g;
+    uint32_t i;
+
+    if (shard->busy != 0 || shard->groupCount == 0) {
+        return 0;
+    }
+
+    for (g = 0; g < shard->groupCount; g++) {
+        const SimpleButton_Type_ShardGroup_t* const group = &(shard->groups[g]);
+        if ((SimpleButton_Posix_ReadPort(group->port) & group->mask) != group->idle) {
+            return 0;
+        }
+    }
+
+    /* an EXTI (`SimpleButton_Shard_RaiseIRQ()`) can move a button to `Push_Delay`
+       while its pin already reads idle again, it must still be handled */
+    for (i = 0; i < shard->count; i++) {
+        if ((simpleButton_Type_ButtonState_t)(shard->buttons[i].Private.state)
+            != simpleButton_State_Wait_For_Interrupt
+        ) {
+            return 0;
+        }
+    }
+
+    return 1;
+}
+
+/* Handle the shards of worker `id` : id, id + threadCount, ... */
+static void
+simpleButton_Shard_Work(SimpleButton_Type_ShardSet_t* const set, const uint32_t id)
+{
+    uint32_t s;
+
+    for (s = id; s < set->shardCount; s += set->threadCount) {
+        SimpleButton_Type_Shard_t* const shard = &(set->shards[s]);
+        uint32_t busy = 0;
+        uint32_t i;
+
+        pthread_mutex_lock(&(shard->lock));
+
+        if (simpleButton_Shard_CanSkip(shard)) {
+            shard->skipped ++;
+            pthread_mutex_unlock(&(shard->lock));
+            continue;
+        }
+
+        SimpleButton_Posix_SetThreadLock(&(shard->lock));
+
+        for (i = 0; i < shard->count; i++) {
+            g_shard_current_button = shard->firstButton + i;
+
+            SimpleButton_DynamicButton_Handler(
+                &(shard->buttons[i]),
+                set->callBacks.shortPushCallBack,
+                set->callBacks.longPushCallBack,
+                set->callBacks.repeatPushCallBack
+            );
+
+            if ((simpleButton_Type_ButtonState_t)(shard->buttons[i].Private.state)
+                != simpleButton_State_Wait_For_Interrupt
+            ) {
+                busy ++;
+            }
+        }
+
+        SimpleButton_Posix_SetThreadLock(0);
+
+        shard->busy = busy;
+        shard->passes ++;
+
+        pthread_mutex_unlock(&(shard->lock));
+    }
+}
+
+static void*
+simpleButton_Shard_Worker(void* arg)
+{
+    SimpleButton_Type_ShardWorker_t* const worker = (SimpleButton_Type_ShardWorker_t*)arg;
+    SimpleButton_Type_ShardSet_t* const set = worker->set;
+    uint32_t generation = 0;
+
+    for (;;) {
+        pthread_mutex_lock(&(set->lock));
+        while (set->generation == generation && !set->stop) {
+            pthread_cond_wait(&(set->wake), &(set->lock));
+        }
+        if (set->stop) {
+            pthread_mutex_unlock(&(set->lock));
+            break;
+        }
+        generation = set->generation;
+        pthread_mutex_unlock(&(set->lock));
+
+        simpleButton_Shard_Work(set, worker->id);
+
+        pthread_mutex_lock(&(set->lock));
+        if (-- set->running == 0) {
+            pthread_cond_signal(&(set->done));
+        }
+        pthread_mutex_unlock(&(set->lock));
+    }
+
+    return 0;
+}
+
+/**
+ * @brief   Split the buttons into shards and start the worker threads.
+ *
+ * @param   set - The shard set.
+ * @param   shards - Storage of `shardCount` shards.
+ * @param   shardCount - The number of shards. (better a multiple of threadCount)
+ * @param   buttons - The dynamic-buttons, already initialized.
+ * @param   buttonCount - The number of buttons.
+ * @param   threadCount - The number of threads, the caller of
+ *          `SimpleButton_Shard_HandleAll()` included. (1 ~ SIMPLEBTN_POSIX_SHARD_MAX_THREADS)
+ *
+ * @note    Shard N gets the buttons `[N * buttonCount / shardCount, (N + 1) * buttonCount / shardCount)`,
+ *          so keep the buttons of a port (and of a combination) next to each other.
+ */
+void
+SimpleButton_Shard_Init(
+    SimpleButton_Type_ShardSet_t* const set,
+    SimpleButton_Type_Shard_t* const shards,
+    uint32_t shardCount,
+    SimpleButton_Type_DynamicBtn_t* const buttons,
+    uint32_t buttonCount,
+    uint32_t threadCount
+) {
+    pthread_mutexattr_t attr;
+    uint32_t i;
+
+    if (threadCount == 0) {
+        threadCount = 1;
+    }
+    if (threadCount > SIMPLEBTN_POSIX_SHARD_MAX_THREADS) {
+        threadCount = SIMPLEBTN_POSIX_SHARD_MAX_THREADS;
+    }
+
+    set->shards = shards;
+    set->shardCount = shardCount;
+    set->callBacks.shortPushCallBack = 0;
+    set->callBacks.longPushCallBack = 0;
+    set->callBacks.repeatPushCallBack = 0;
+    set->threadCount = threadCount;
+    set->generation = 0;
+    set->running = 0;
+    set->stop = 0;
+
+    /* the handlers take the shard lock again from inside */
+    pthread_mutexattr_init(&attr);
+    pthread_mutexattr_settype(&attr, PTHREAD_MUTEX_RECURSIVE);
+
+    for (i = 0; i < shardCount; i++) {
+        const uint32_t first = (uint32_t)((uint64_t)i * buttonCount / shardCount);
+        const uint32_t last = (uint32_t)((uint64_t)(i + 1U) * buttonCount / shardCount);
+
+        shards[i].buttons = &(buttons[first]);
+        shards[i].firstButton = first;
+        shards[i].count = last - first;
+        shards[i].busy = 0;
+        shards[i].passes = 0;
+        shards[i].skipped = 0;
+        pthread_mutex_init(&(shards[i].lock), &attr);
+        simpleButton_Shard_BuildGroups(&(shards[i]));
+    }
+
+    pthread_mutexattr_destroy(&attr);
+
+    pthread_mutex_init(&(set->lock), 0);
+    pthread_cond_init(&(set->wake), 0);
+    pthread_cond_init(&(set->done), 0);
+
+    /* worker 0 is the caller of SimpleButton_Shard_HandleAll() */
+    for (i = 1; i < threadCount; i++) {
+        set->workers[i].set = set;
+        set->workers[i].id = i;
+        pthread_create(&(set->workers[i].thread), 0, simpleButton_Shard_Worker, &(set->workers[i]));
+    }
+}
+
+/**
+ * @brief   Handle all the shards once, and return when all the threads are done.
+ *
+ * @param   set - The shard set.
+ *
+ * @note    The callbacks run in the worker threads, use
+ *          `SimpleButton_Shard_CurrentButton()` in them to get the button.
+ */
+void
+SimpleButton_Shard_HandleAll(
+    SimpleButton_Type_ShardSet_t* const set
+) {
+    if (set->threadCount > 1) {
+        pthread_mutex_lock(&(set->lock));
+        set->running = set->threadCount - 1U;
+        set->generation ++;
+        pthread_cond_broadcast(&(set->wake));
+        pthread_mutex_unlock(&(set->lock));
+    }
+
+    simpleButton_Shard_Work(set, 0);
+
+    if (set->threadCount > 1) {
+        pthread_mutex_lock(&(set->lock));
+        while (set->running != 0) {
+            pthread_cond_wait(&(set->done), &(set->lock));
+        }
+        pthread_mutex_unlock(&(set->lock));
+    }
+}
+
+/**
+ * @brief   Stop the worker threads.
+ *
+ * @param   set - The shard set.
+ */
+void
+SimpleButton_Shard_Deinit(
+    SimpleButton_Type_ShardSet_t* const set
+) {
+    uint32_t i;
+
+    pthread_mutex_lock(&(set->lock));
+    set->stop = 1;
+    pthread_cond_broadcast(&(set->wake));
+    pthread_mutex_unlock(&(set->lock));
+
+    for (i = 1; i < set->threadCount; i++) {
+        pthread_join(set->workers[i].thread, 0);
+    }
+
+    for (i = 0; i < set->shardCount; i++) {
+        pthread_mutex_destroy(&(set->shards[i].lock));
+    }
+    pthread_cond_destroy(&(set->done));
+    pthread_cond_destroy(&(set->wake));
+    pthread_mutex_destroy(&(set->lock));
+}
+
+/**
+ * @brief   Run `isr` as the EXTI of button `button` : never in the middle of
+ *          a critical section of its shard, nor of a global one.
+ *
+ * @param   set - The shard set.
+ * @param   button - The index of the button in the whole array.
+ * @param   isr - The interrupt service routine, e.g. it calls
+ *          `simpleButton_Private_InterruptHandler()` of the button.
+ *
+ * @note    The critical sections of the workers only take the shard lock,
+ *          so `SimpleButton_Posix_RaiseIRQ()` alone would run the ISR in the
+ *          middle of them. Use this one for the buttons of a shard set.
+ */
+void
+SimpleButton_Shard_RaiseIRQ(
+    SimpleButton_Type_ShardSet_t* const set,
+    uint32_t button,
+    void (* isr)(void)
+) {
+    SimpleButton_Type_Shard_t* shard;
+    uint32_t low = 0;
+    uint32_t high = set->shardCount;
+
+    /* the last shard which begins at or before the button owns it */
+    while (high - low > 1U) {
+        const uint32_t middle = low + (high - low) / 2U;
+
+        if (set->shards[middle].firstButton <= button) {
+            low = middle;
+        } else {
+            high = middle;
+        }
+    }
+    shard = &(set->shards[low]);
+
+    pthread_mutex_lock(&(shard->lock));
+    SimpleButton_Posix_RaiseIRQ(isr);
+    pthread_mutex_unlock(&(shard->lock));
+}
+
+/**
+ * @brief   The index of the button whose callback is running in this thread.
+ */
+uint32_t
+SimpleButton_Shard_CurrentButton(void)
+{
+    return g_shard_current_button;
+}
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
@@ -0,0 +1,137 @@
+/**
+ * @file            sBtn_posix_shard.h
+ *
+ * @author          Kim-J-Smith
+ *
+ * @brief           Header file of the sharded poller. A large array of
+ *                  dynamic-buttons is split into shards, which are handled
+ *                  by a group of worker threads on the POSIX host. Every
+ *                  shard has its own lock instead of the global critical
+ *                  section, and idle shards are skipped with a few port reads.
+ *                  The EXTI of their buttons must be raised with
+ *                  `SimpleButton_Shard_RaiseIRQ()`, which takes the shard lock.
+ *
+ * @version         0.1.0 ( 0001L )
+ *
+ * @date            2025-10-03
+ *
+ * @attention       Copyright (c) 2025 Kim-J-Smith.
+ *                  All rights reserved.
+ *
+ * @copyright       SPDX-License-Identifier: MIT
+ *                  Refer to the LICENCE file in root for more details.
+ *                  <https://github.com/Kim-J-Smith/Simple-Button>
+ */
+#ifndef     SIMPLEBUTTON_POSIX_SHARD_H__
+#define     SIMPLEBUTTON_POSIX_SHARD_H__    0001L
+
+#include    "Simple_Button.h"
+#include    <pthread.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/* Max port words of a shard for the idle check (more : the shard is never skipped) */
+#ifndef SIMPLEBTN_POSIX_SHARD_MAX_GROUPS
+ #define SIMPLEBTN_POSIX_SHARD_MAX_GROUPS   32
+#endif /* SIMPLEBTN_POSIX_SHARD_MAX_GROUPS */
+
+/* Max worker threads, the caller included */
+#ifndef SIMPLEBTN_POSIX_SHARD_MAX_THREADS
+ #define SIMPLEBTN_POSIX_SHARD_MAX_THREADS  64
+#endif /* SIMPLEBTN_POSIX_SHARD_MAX_THREADS */
+
+/* The pins of a shard on one port, and their idle levels. (internal use) */
+typedef struct SimpleButton_Type_ShardGroup_t {
+
+    uint32_t    port;
+    uint16_t    mask;
+    uint16_t    idle;
+
+} SimpleButton_Type_ShardGroup_t;
+
+/* One shard : a contiguous range of buttons and its lock. */
+typedef struct SimpleButton_Type_Shard_t {
+
+    SimpleButton_Type_DynamicBtn_t*     buttons;
+    uint32_t                            firstButton;    /* index of buttons[0] in the whole array */
+    uint32_t                            count;
+
+    pthread_mutex_t                     lock;           /* the critical section of these buttons */
+
+    SimpleButton_Type_ShardGroup_t      groups[SIMPLEBTN_POSIX_SHARD_MAX_GROUPS];
+    uint32_t                            groupCount;     /* 0 : can not be skipped */
+
+    uint32_t                            busy;           /* buttons not idle after the last pass */
+    uint64_t                            passes;         /* passes which ran the buttons */
+    uint64_t                            skipped;        /* passes skipped as idle */
+
+} SimpleButton_Type_Shard_t;
+
+struct SimpleButton_Type_ShardSet_t; /* just declare */
+
+/* One worker thread. (internal use) */
+typedef struct SimpleButton_Type_ShardWorker_t {
+
+    struct SimpleButton_Type_ShardSet_t* set;
+    pthread_t                           thread;
+    uint32_t                            id;
+
+} SimpleButton_Type_ShardWorker_t;
+
+/* The shards and the worker threads which handle them. */
+typedef struct SimpleButton_Type_ShardSet_t {
+
+    SimpleButton_Type_Shard_t*          shards;
+    uint32_t                            shardCount;
+
+    simpleButton_Type_CallBackSet_t     callBacks;      /* shared by all the buttons */
+
+    SimpleButton_Type_ShardWorker_t     workers[SIMPLEBTN_POSIX_SHARD_MAX_THREADS];
+    uint32_t                            threadCount;
+
+    pthread_mutex_t                     lock;
+    pthread_cond_t                      wake;
+    pthread_cond_t                      done;
+    uint32_t                            generation;     /* one more for each pass */
+    uint32_t                            running;        /* workers still in this pass */
+    uint8_t                             stop;
+
+} SimpleButton_Type_ShardSet_t;
+
+void
+SimpleButton_Shard_Init(
+    SimpleButton_Type_ShardSet_t* const set,
+    SimpleButton_Type_Shard_t* const shards,
+    uint32_t shardCount,
+    SimpleButton_Type_DynamicBtn_t* const buttons,
+    uint32_t buttonCount,
+    uint32_t threadCount
+);
+
+void
+SimpleButton_Shard_HandleAll(
+    SimpleButton_Type_ShardSet_t* const set
+);
+
+void
+SimpleButton_Shard_Deinit(
+    SimpleButton_Type_ShardSet_t* const set
+);
+
+void
+SimpleButton_Shard_RaiseIRQ(
+    SimpleButton_Type_ShardSet_t* const set,
+    uint32_t button,
+    void (* isr)(void)
+);
+
+uint32_t
+SimpleButton_Shard_CurrentButton(void);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* SIMPLEBUTTON_POSIX_SHARD_H__ */
@@ -0,0 +1,280 @@
+/**
+ * @file            simple_button_config.h
+ *
+ * @author          Kim-J-Smith
+ *
+ * @brief           The configuration file of the Simple_Button file.
+ *                  (POSIX host port, used for simulation and benchmark)
+ *
+ * @version         0.8.x
+ *
+ * @date            2025-10-03
+ *
+ * @attention       Copyright (c) 2025 Kim-J-Smith.
+ *                  All rights reserved.
+ *
+ * @copyright       SPDX-License-Identifier: MIT
+ *                  Refer to the LICENCE file in root for more details.
+ *
+ *                  <https://github.com/Kim-J-Smith/Simple-Button>
+ */
+#ifndef     SIMPLEBUTTON_CONFIG_H__
+#define     SIMPLEBUTTON_CONFIG_H__     1020L
+#include <stdint.h>
+
+/** @p ================================================================ **/
+/* ====================== CUSTOMIZATION BEGIN ========================== */
+
+
+/*************************************************************************
+ * @b Contents
+ *
+ * 1. @e Head-File (Your head file depending on your chip)
+ *
+ * 2. @e Simple-Button-Type (The Types used by Simple-Button)
+ *
+ * 3. @e Other-Functions (Functions for read-pin, debug, low-power, ...)
+ *
+ * 4. @e Time-Set (To set the adjustable time, such as repeat-push window.
+ *                  All these times will be set as default times,
+ *                  which can still be changed for each button.)
+ *
+ * 5. @e Mode-Set (The mode of button, such as combination / timer-long-push / ...)
+ *
+ * 6. @e Namespace (The namespace of Simple-Button public functions and variables)
+ *
+ * 7. @e Initialization-Function (To init the GPIO, EXTI, NVIC/PFIC, etc)
+ *
+ * @note The Mode-Set of the host port can be overridden from the compiler
+ *       command line, e.g. `-DSIMPLEBTN_MODE_ENABLE_DEBUG=0`.
+ *
+ *************************************************************************
+ */
+
+/** @b ================================================================ **/
+/** @b Head-File */
+#include <stdio.h>
+#include <stdlib.h>
+#include "sBtn_posix_port.h"
+
+/** @b ================================================================ **/
+/** @b Simple-Button-Type */
+
+// The type of GPIOX_BASE. (index of the simulated port)
+typedef uint32_t            simpleButton_Type_GPIOBase_t;
+// The type of GPIO_PIN_X. (bit mask of the simulated pin, like GPIO_PIN_X)
+typedef uint16_t            simpleButton_Type_GPIOPin_t;
+// The type of Value of Pin. (The value usually be 0 or 1)
+typedef uint8_t             simpleButton_Type_GPIOPinVal_t;
+// The type of EXTI_TRIGGER_X. (X can be FALLING / RAISING / ...)
+typedef uint32_t            simpleButton_Type_EXTITrigger_t;
+
+#define SIMPLEBTN_EXTI_TRIGGER_FALLING      SIMPLEBTN_POSIX_TRIGGER_FALLING
+
+/** @b ================================================================ **/
+/** @b Other-Functions */
+
+#define SIMPLEBTN_FUNC_READ_PIN(GPIOX_Base, Pin) \
+    SimpleButton_Posix_ReadPin(GPIOX_Base, Pin)
+
+#define SIMPLEBTN_FUNC_GET_TICK() \
+    SimpleButton_Posix_GetTick()
+
+#define SIMPLEBTN_FUNC_GET_TICK_FromISR() \
+    SimpleButton_Posix_GetTick()
+
+#define SIMPLEBTN_FUNC_GET_TIME_US_FromISR() \
+    ((uint32_t)SimpleButton_Posix_GetTimeUs())
+
+#define SIMPLEBTN_FUNC_PANIC(Cause, ErrorNum, etc) \
+    simpleButton_debug_panic(Cause, ErrorNum) /* only used in DEBUG mode */
+
+#define SIMPLEBTN_FUNC_CRITICAL_SECTION_BEGIN() \
+    SimpleButton_Posix_CriticalSectionBegin()
+
+#define SIMPLEBTN_FUNC_CRITICAL_SECTION_END() \
+    SimpleButton_Posix_CriticalSectionEnd()
+
+#define SIMPLEBTN_FUNC_START_LOW_POWER() \
+    SimpleButton_Posix_LowPower()
+
+#define SIMPLEBTN_FUNC_DEFERRED_PEND() \
+    SimpleButton_Posix_PendSoftIRQ()
+
+#define SIMPLEBTN_FUNC_TIMER_START() \
+    SimpleButton_Posix_StartTimer(SimpleButton_TimerDriven_Handler, SIMPLEBTN_TIME_TIMER_PERIOD)
+
+#define SIMPLEBTN_FUNC_TIMER_STOP() \
+    SimpleButton_Posix_StopTimer()
+
+#define SIMPLEBTN_FUNC_TIMER_RELOAD(periodMs) \
+    SimpleButton_Posix_StartTimer(SimpleButton_TimerDriven_Handler, (periodMs))
+
+/** @b ================================================================ **/
+/** @b Time-Set */
+
+    // The delay time after you push the button.
+#define SIMPLEBTN_TIME_PUSH_DELAY                       30
+    // The delay time after you release the button.
+#define SIMPLEBTN_TIME_RELEASE_DELAY                    30
+    // The minimum time to push the button for long-push.
+#define SIMPLEBTN_TIME_LONG_PUSH_MIN                    1000
+    // The window time for repeat-push.
+#define SIMPLEBTN_TIME_REPEAT_WINDOW                    300
+    // The cool-down time after you release the button.
+#define SIMPLEBTN_TIME_COOL_DOWN                        0
+    // The minimum time to push the button for long-push-hold.
+#define SIMPLEBTN_TIME_HOLD_PUSH_MIN                    SIMPLEBTN_TIME_LONG_PUSH_MIN
+    // The interval time to call callback function in hold-long-push mode.
+#define SIMPLEBTN_TIME_HOLD_INTERVAL                    200
+    // The timeout time for normal long button.
+#define SIMPLEBTN_TIME__TIMEOUT_NORMAL                  (1000 * 120)
+    // The timeout time for combination long button.
+#define SIMPLEBTN_TIME__TIMEOUT_COMBINATION             (1000 * 240)
+    // The lower bound of the learned bounce time in adaptive-debounce mode.
+#define SIMPLEBTN_TIME_DEBOUNCE_MIN                     2
+    // The safety margin added to the learned bounce time in adaptive-debounce mode.
+#define SIMPLEBTN_TIME_DEBOUNCE_MARGIN                  3
+    // The maximum push count of repeat-push. (decide at once when it is reached)
+#define SIMPLEBTN_REPEAT_MAX_COUNT                      0xFF
+    // The max idle time between two events of a gesture sequence.
+#define SIMPLEBTN_TIME_GESTURE_TIMEOUT                  1500
+    // The max time from the first key of a chord to the last.
+#define SIMPLEBTN_TIME_CHORD_WINDOW                     50
+    // The period of the timer interrupt in timer-driven mode. (set the timer to it)
+#define SIMPLEBTN_TIME_TIMER_PERIOD                     1
+    // The poll interval of an idle dynamic-button in adaptive polling mode.
+#define SIMPLEBTN_TIME_IDLE_POLL_INTERVAL               20
+
+/** @b ================================================================ **/
+/** @b Mode-Set */
+
+    // Enable debug mode if this macro is defined as 1.
+#ifndef SIMPLEBTN_MODE_ENABLE_DEBUG
+ #define SIMPLEBTN_MODE_ENABLE_DEBUG                    1
+#endif
+    // Enable combination mode if this macro is defined as 1.
+#ifndef SIMPLEBTN_MODE_ENABLE_COMBINATION
+ #define SIMPLEBTN_MODE_ENABLE_COMBINATION              1
+#endif
+    // Enable timer long-push mode if this macro is defined as 1.
+#ifndef SIMPLEBTN_MODE_ENABLE_TIMER_LONG_PUSH
+ #define SIMPLEBTN_MODE_ENABLE_TIMER_LONG_PUSH          1
+#endif
+    // Enable counter repeat-push mode if this macro is defined as 1.
+#ifndef SIMPLEBTN_MODE_ENABLE_COUNTER_REPEAT_PUSH
+ #define SIMPLEBTN_MODE_ENABLE_COUNTER_REPEAT_PUSH      1
+#endif
+    // Enable adjustable mode if this macro is defined as 1.
+#ifndef SIMPLEBTN_MODE_ENABLE_ADJUSTABLE_TIME
+ #define SIMPLEBTN_MODE_ENABLE_ADJUSTABLE_TIME          1
+#endif
+    // Enable multi-threads mode(enable this only when you do use multi-thread) if this macro is defined as 1.
+#ifndef SIMPLEBTN_MODE_ENABLE_MULTI_THREADS
+ #define SIMPLEBTN_MODE_ENABLE_MULTI_THREADS            1
+#endif
+    // Enable long-push-hold mode if this macro is defined as 1.
+#ifndef SIMPLEBTN_MODE_ENABLE_LONGPUSH_HOLD
+ #define SIMPLEBTN_MODE_ENABLE_LONGPUSH_HOLD            1
+#endif
+    // Enable adaptive-debounce mode (learn the bounce time of each button) if this macro is defined as 1.
+#ifndef SIMPLEBTN_MODE_ENABLE_ADAPTIVE_DEBOUNCE
+ #define SIMPLEBTN_MODE_ENABLE_ADAPTIVE_DEBOUNCE        0
+#endif
+    // Enable pressed/released event mode if this macro is defined as 1.
+#ifndef SIMPLEBTN_MODE_ENABLE_PRESS_RELEASE_EVENT
+ #define SIMPLEBTN_MODE_ENABLE_PRESS_RELEASE_EVENT      0
+#endif
+    // Enable registry mode (handle / init all buttons without listing them) if this macro is defined as 1.
+#ifndef SIMPLEBTN_MODE_ENABLE_REGISTRY
+ #define SIMPLEBTN_MODE_ENABLE_REGISTRY                 0
+#endif
+    // Enable lock-free handoff mode (ISR and loop swap the state by CAS, no interrupt masking) if this macro is defined as 1.
+#ifndef SIMPLEBTN_MODE_ENABLE_LOCKFREE_HANDOFF
+ #define SIMPLEBTN_MODE_ENABLE_LOCKFREE_HANDOFF         0
+#endif
+    // Enable snapshot mode (read the state of a button from any thread / ISR without critical section) if this macro is defined as 1.
+#ifndef SIMPLEBTN_MODE_ENABLE_SNAPSHOT
+ #define SIMPLEBTN_MODE_ENABLE_SNAPSHOT                 0
+#endif
+    // Enable deferred callback mode (callbacks are queued and called by SimpleButton_Deferred_Drain()) if this macro is defined as 1.
+#ifndef SIMPLEBTN_MODE_ENABLE_DEFERRED_CALLBACK
+ #define SIMPLEBTN_MODE_ENABLE_DEFERRED_CALLBACK        0
+#endif
+    // Enable timer-driven mode (a periodic timer interrupt runs the registered buttons, started by EXTI) if this macro is defined as 1.
+#ifndef SIMPLEBTN_MODE_ENABLE_TIMER_DRIVEN
+ #define SIMPLEBTN_MODE_ENABLE_TIMER_DRIVEN             0
+#endif
+    // Enable adaptive polling mode (idle dynamic-buttons are polled at a slow rate) if this macro is defined as 1.
+#ifndef SIMPLEBTN_MODE_ENABLE_ADAPTIVE_POLLING
+ #define SIMPLEBTN_MODE_ENABLE_ADAPTIVE_POLLING         0
+#endif
+
+/** @b ================================================================ **/
+/** @b Namespace */
+
+/**
+ * @brief   The namespace of Simple-Button public functions and variables.
+ *
+ * @note    This namespace can be changed to avoid name conflicts.
+ *          Default: SimpleButton_
+ */
+#define SIMPLEBTN_NAMESPACE                             SimpleButton_
+
+/** @b ================================================================ **/
+/** @b Initialization-Function */
+
+/* This macro just forward the parameter to another function */
+#define SIMPLEBTN_FUNC_INIT_EXTI(GPIOX_Base, GPIO_Pin_X, EXTI_Trigger_X) \
+    simpleButton_Private_InitEXTI(GPIOX_Base, GPIO_Pin_X, EXTI_Trigger_X)
+
+/* ====================== CUSTOMIZATION END ============================ */
+/** @p ================================================================ **/
+
+
+// Macro for force-inline
+#if defined(__GNUC__) || defined(__clang__)
+ #define SIMPLEBTN_FORCE_INLINE static inline __attribute__((always_inline))
+#elif defined(_MSC_VER) || defined(__CC_ARM)
+ #define SIMPLEBTN_FORCE_INLINE static __forceinline
+#else
+ #define SIMPLEBTN_FORCE_INLINE static inline
+#endif
+
+/* ================ OTHER LOCAL-PLATFORM CUSTOMIZATION ================= */
+
+typedef enum simpleButton_Type_ErrorNum_t {
+
+    simpleButton_ErrorNum_NormalPushTimeOut = 0,
+    simpleButton_ErrorNum_CmbPushTimeOut,
+    simpleButton_ErrorNum_invalidState,
+    simpleButton_ErrorNum_invalidInput,
+    simpleButton_ErrorNum_NoInit,
+
+} simpleButton_Type_ErrorNum_t;
+
+SIMPLEBTN_FORCE_INLINE void
+simpleButton_debug_panic(const char* errCase, simpleButton_Type_ErrorNum_t errNum)
+{
+    /* Only called in debug mode */
+    fprintf(stderr, "[Simple-Button] panic(%d): %s\n", (int)errNum, errCase);
+    abort();
+}
+
+SIMPLEBTN_FORCE_INLINE
+void simpleButton_Private_InitEXTI(
+    simpleButton_Type_GPIOBase_t    GPIOX_Base,
+    simpleButton_Type_GPIOPin_t     GPIO_Pin_X,
+    simpleButton_Type_EXTITrigger_t EXTI_Trigger_X
+) {
+    /* Simulated pins idle at their inactive level */
+    SimpleButton_Posix_WritePin(
+        GPIOX_Base,
+        GPIO_Pin_X,
+        (uint8_t)((EXTI_Trigger_X == SIMPLEBTN_POSIX_TRIGGER_FALLING) ? 1 : 0)
+    );
+}
+
+/* ================================ END ================================ */
+
+#endif /* SIMPLEBUTTON_CONFIG_H__ */
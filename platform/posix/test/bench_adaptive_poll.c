@@ -0,0 +1,135 @@
+/**
+ * @file            bench_adaptive_poll.c
+ *
+ * @author          Kim-J-Smith
+ *
+ * @brief           Host benchmark of adaptive polling : 16 registered dynamic
+ *                  buttons over 10 minutes, handled every ms, then only when
+ *                  `SimpleButton_Registry_NextPoll()` says so (the MCU sleeps
+ *                  in between). Shows the wakeups and the CPU time of both,
+ *                  which must see the same events. Also checks that a button
+ *                  of a pool is polled at once after its creation.
+ *
+ * @version         0.1.0 ( 0001L )
+ *
+ * @date            2025-10-03
+ *
+ * @attention       Copyright (c) 2025 Kim-J-Smith.
+ *                  All rights reserved.
+ *
+ * @copyright       SPDX-License-Identifier: MIT
+ *                  Refer to the LICENCE file in root for more details.
+ *                  <https://github.com/Kim-J-Smith/Simple-Button>
+ */
+#include    "sBtn_pool.h"
+#include    "sBtn_posix_test.h"
+
+#define BENCH_BUTTONS       16U
+#define BENCH_TICKS         600000U
+#define BENCH_PORT          1U
+
+SIMPLEBTN__DYNPOOL_CREATE(4, BP)
+
+static SimpleButton_Type_DynamicBtn_t g_buttons[BENCH_BUTTONS];
+
+/* The events of the run every ms (0) and of the run with sleeps (1) */
+static uint32_t g_events[2][3];
+static uint8_t g_side;
+
+static void bench_ShortPush(void) { g_events[g_side][0] ++; }
+static void bench_LongPush(uint32_t time) { (void)time; g_events[g_side][1] ++; }
+static void bench_RepeatPush(uint8_t count) { (void)count; g_events[g_side][2] ++; }
+
+/* Button K (active-low) is pushed once in each of its periods, of 20 s and more */
+static void
+bench_Drive(uint32_t t)
+{
+    uint32_t k;
+
+    for (k = 0; k < BENCH_BUTTONS; k++) {
+        const uint32_t hold = (k % 3U == 0) ? 1400U : 90U + k * 5U;
+        const uint8_t pushed = (uint8_t)((t + k * 211U) % (20000U + k * 3100U) < hold);
+
+        SimpleButton_Posix_WritePin(BENCH_PORT, 1UL << k, (uint8_t)!pushed);
+    }
+}
+
+/* Run the buttons from a fresh start, return the wakeups */
+static uint32_t
+bench_Run(uint8_t is_sleeping, uint64_t* const used)
+{
+    uint32_t wakeups = 0, k, t;
+
+    SimpleButton_Posix_SetTime(1000000U);
+    bench_Drive(0);
+    for (k = 0; k < BENCH_BUTTONS; k++) {
+        simpleButton_Private_InitStructPrivate(&(g_buttons[k].Private));
+        simpleButton_Private_InitStructPublic(&(g_buttons[k].Public));
+        g_buttons[k].nextPollTick = SimpleButton_Posix_GetTick();
+    }
+
+    *used = 0;
+    for (t = 0; t < BENCH_TICKS; ) {
+        uint64_t begin;
+
+        SimpleButton_Posix_SetTime((uint64_t)t * 1000U + 1000000U);
+        bench_Drive(t);
+
+        begin = SimpleButton_Posix_GetNs();
+        SimpleButton_Registry_HandleAll();
+        *used += SimpleButton_Posix_GetNs() - begin;
+        wakeups ++;
+
+        if (is_sleeping) {
+            const uint32_t next = SimpleButton_Registry_NextPoll();
+            t += (next != 0) ? next : 1U;
+        } else {
+            t ++;
+        }
+    }
+
+    return wakeups;
+}
+
+int main(void)
+{
+    SimpleButton_Type_PoolHandle_t handle;
+    uint64_t used[2];
+    uint32_t wakeups[2], k;
+
+    SimpleButton_Posix_SetClock(SimpleButton_PosixClock_Virtual);
+
+    for (k = 0; k < BENCH_BUTTONS; k++) {
+        SimpleButton_DynamicButton_Init(&g_buttons[k], BENCH_PORT, 1UL << k, 1);
+        SIMPLEBTN__REGISTRY_SETCALLBACK(g_buttons[k], bench_ShortPush, bench_LongPush, bench_RepeatPush);
+    }
+
+    for (g_side = 0; g_side < 2; g_side++) {
+        wakeups[g_side] = bench_Run(g_side, &used[g_side]);
+    }
+
+    printf("  every ms       : %6u wakeups, %8.1f us/s (short %u, long %u, repeat %u)\n",
+        wakeups[0], (double)used[0] / (BENCH_TICKS / 1000U) / 1000.0,
+        g_events[0][0], g_events[0][1], g_events[0][2]);
+    printf("  until NextPoll : %6u wakeups, %8.1f us/s (short %u, long %u, repeat %u)\n",
+        wakeups[1], (double)used[1] / (BENCH_TICKS / 1000U) / 1000.0,
+        g_events[1][0], g_events[1][1], g_events[1][2]);
+
+    SIMPLEBTN_TEST_CHECK(wakeups[0] == BENCH_TICKS);
+    SIMPLEBTN_TEST_CHECK(wakeups[1] < wakeups[0] / 2U);
+    SIMPLEBTN_TEST_CHECK(g_events[1][0] == g_events[0][0]);
+    SIMPLEBTN_TEST_CHECK(g_events[1][1] == g_events[0][1]);
+    SIMPLEBTN_TEST_CHECK(g_events[1][2] == g_events[0][2]);
+
+    /* a new button of a pool is polled at once, even when the tick is far from 0 */
+    SimpleButton_Posix_SetTime((uint64_t)0x80000010UL * 1000U);
+    SimpleButton_Posix_WritePin(BENCH_PORT + 1U, 1, 0);
+    SimpleButton_BP_Init();
+    handle = SimpleButton_DynamicPool_Create(&SimpleButton_BP, BENCH_PORT + 1U, 1, 1,
+        bench_ShortPush, bench_LongPush, bench_RepeatPush);
+    SimpleButton_DynamicPool_HandleAll(&SimpleButton_BP);
+    SIMPLEBTN_TEST_CHECK(handle != SIMPLEBTN_POOL_INVALID_HANDLE);
+    SIMPLEBTN_TEST_CHECK(!SimpleButton_DynamicPool_AllIdle(&SimpleButton_BP));
+
+    return SIMPLEBTN_TEST_RESULT();
+}
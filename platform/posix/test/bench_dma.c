@@ -0,0 +1,142 @@
+/**
+ * @file            bench_dma.c
+ *
+ * @author          Kim-J-Smith
+ *
+ * @brief           Host benchmark of the DMA scanning engine : the CPU time per
+ *                  ms of 64 keys (4 ports) handled in batches of a circular
+ *                  buffer, against the same keys polled one by one every ms.
+ *                  The keys bounce for 3 ms at each edge, both ways must see
+ *                  the same events.
+ *
+ * @version         0.1.0 ( 0001L )
+ *
+ * @date            2025-10-03
+ *
+ * @attention       Copyright (c) 2025 Kim-J-Smith.
+ *                  All rights reserved.
+ *
+ * @copyright       SPDX-License-Identifier: MIT
+ *                  Refer to the LICENCE file in root for more details.
+ *                  <https://github.com/Kim-J-Smith/Simple-Button>
+ */
+#include    "sBtn_posix_dma.h"
+#include    "sBtn_posix_test.h"
+
+#define BENCH_PORTS         4U
+#define BENCH_KEYS          (BENCH_PORTS * SIMPLEBTN_DMA_PORT_PINS)
+#define BENCH_DEPTH         20U
+#define BENCH_TICKS         60000U
+#define BENCH_QUIET         2000U   /* all the keys are released at the end, no event is pending */
+
+SIMPLEBTN__DMASCAN_CREATE(BENCH_PORTS, BENCH_DEPTH, BD)
+
+static simpleButton_Type_VirtualKey_t g_reference[BENCH_KEYS];
+static SimpleButton_Type_DmaPort_t g_ports[BENCH_PORTS];
+
+/* The events seen by the polled keys (0) and by the DMA scanner (1) */
+static uint32_t g_events[2][3];
+static uint8_t g_side;
+
+static void bench_ShortPush(void) { g_events[g_side][0] ++; }
+static void bench_LongPush(uint32_t time) { (void)time; g_events[g_side][1] ++; }
+static void bench_RepeatPush(uint8_t count) { (void)count; g_events[g_side][2] ++; }
+
+/* Key K of port K/16 (active-low) is pushed for a while in each of its periods, and bounces at the edges */
+static void
+bench_Drive(uint32_t t)
+{
+    uint32_t k;
+
+    for (k = 0; k < BENCH_KEYS; k++) {
+        const uint32_t hold = (k % 4U == 0) ? 1300U : 120U;
+        const uint32_t phase = (t + k * 37U) % (700U + (k % 5U) * 90U + hold);
+        uint8_t pushed = (uint8_t)(phase >= 80U && phase < 80U + hold);
+
+        if ((phase >= 80U && phase < 83U) || (phase >= 80U + hold && phase < 83U + hold)) {
+            pushed = (uint8_t)(t & 1U);
+        }
+        if (t + 80U < phase || t - phase + 83U + hold > BENCH_TICKS - BENCH_QUIET) {
+            pushed = 0; /* only whole pushes, none is cut at the start or by the quiet end */
+        }
+        SimpleButton_Posix_WritePin(k / SIMPLEBTN_DMA_PORT_PINS + 1U,
+            1UL << (k % SIMPLEBTN_DMA_PORT_PINS), (uint8_t)!pushed);
+    }
+}
+
+int main(void)
+{
+    SimpleButton_Type_DmaScanConfig_t config;
+    uint64_t polled = 0, batched = 0;
+    uint32_t k, t;
+
+    SimpleButton_Posix_SetClock(SimpleButton_PosixClock_Virtual);
+
+    for (k = 0; k < BENCH_PORTS; k++) {
+        g_ports[k].GPIO_Base = k + 1U;
+        g_ports[k].pinMask = 0xFFFFU;
+        g_ports[k].pinInvert = 0xFFFFU;
+    }
+
+    /* 1. every key polled every ms */
+    SimpleButton_Posix_SetTime(1000000U);
+    for (k = 0; k < BENCH_KEYS; k++) {
+        simpleButton_Private_InitStructPrivate(&(g_reference[k].Private));
+        simpleButton_Private_InitStructPublic(&(g_reference[k].Public));
+    }
+    g_side = 0;
+    for (t = 0; t < BENCH_TICKS; t++) {
+        uint64_t begin;
+
+        SimpleButton_Posix_SetTime((uint64_t)t * 1000U + 1000000U);
+        bench_Drive(t);
+
+        begin = SimpleButton_Posix_GetNs();
+        for (k = 0; k < BENCH_KEYS; k++) {
+            simpleButton_Private_PolledHandler(&(g_reference[k].Private), &(g_reference[k].Public),
+                (uint8_t)!SimpleButton_Posix_ReadPin(k / SIMPLEBTN_DMA_PORT_PINS + 1U,
+                    1UL << (k % SIMPLEBTN_DMA_PORT_PINS)),
+                bench_ShortPush, bench_LongPush, bench_RepeatPush, 0);
+        }
+        polled += SimpleButton_Posix_GetNs() - begin;
+    }
+
+    /* 2. the DMA samples every ms, the CPU handles a batch every BENCH_DEPTH / 2 ms */
+    config.start = SimpleButton_Posix_DmaStart;
+    config.stop = SimpleButton_Posix_DmaStop;
+    config.context = &SimpleButton_BD;
+    config.ports = g_ports;
+    SimpleButton_Posix_SetTime(1000000U); /* the same start as the polled keys */
+    SimpleButton_BD_Init(&config);
+    SIMPLEBTN__DMASCAN_SETCALLBACK(SimpleButton_BD, bench_ShortPush, bench_LongPush, bench_RepeatPush);
+
+    g_side = 1;
+    SimpleButton_DmaScan_Start(&SimpleButton_BD);
+    for (t = 0; t < BENCH_TICKS; t++) {
+        uint64_t begin;
+
+        SimpleButton_Posix_SetTime((uint64_t)t * 1000U + 1000000U);
+        bench_Drive(t);
+        SimpleButton_Posix_DmaTrigger(1);
+
+        begin = SimpleButton_Posix_GetNs();
+        SimpleButton_DmaScan_Handler(&SimpleButton_BD);
+        batched += SimpleButton_Posix_GetNs() - begin;
+    }
+    SimpleButton_DmaScan_Stop(&SimpleButton_BD);
+
+    printf("  polled every ms : %7.1f ns/ms (short %u, long %u, repeat %u)\n",
+        (double)polled / BENCH_TICKS, g_events[0][0], g_events[0][1], g_events[0][2]);
+    printf("  DMA batches     : %7.1f ns/ms (short %u, long %u, repeat %u), %u batches, %u overruns\n",
+        (double)batched / BENCH_TICKS, g_events[1][0], g_events[1][1], g_events[1][2],
+        SimpleButton_BD.batches, SimpleButton_BD.overruns);
+
+    SIMPLEBTN_TEST_CHECK(g_events[1][0] == g_events[0][0]);
+    SIMPLEBTN_TEST_CHECK(g_events[1][1] == g_events[0][1]);
+    SIMPLEBTN_TEST_CHECK(g_events[1][2] == g_events[0][2]);
+    SIMPLEBTN_TEST_CHECK(SimpleButton_BD.batches == BENCH_TICKS / (BENCH_DEPTH / 2U));
+    SIMPLEBTN_TEST_CHECK(SimpleButton_BD.overruns == 0);
+    SIMPLEBTN_TEST_CHECK(SimpleButton_Posix_DmaGetSamples() == BENCH_TICKS);
+
+    return SIMPLEBTN_TEST_RESULT();
+}
@@ -0,0 +1,111 @@
+/**
+ * @file            bench_matrix.c
+ *
+ * @author          Kim-J-Smith
+ *
+ * @brief           Host benchmark of the key-matrix engine : the cost of one
+ *                  full scan (mean, median, 99.9th percentile) for 8x8 and
+ *                  16x16 keys, with 0, 1, one row and all the keys pushed.
+ *                  The maximum depends on the host scheduler, it is not shown.
+ *
+ * @version         0.1.0 ( 0001L )
+ *
+ * @date            2025-10-03
+ *
+ * @attention       Copyright (c) 2025 Kim-J-Smith.
+ *                  All rights reserved.
+ *
+ * @copyright       SPDX-License-Identifier: MIT
+ *                  Refer to the LICENCE file in root for more details.
+ *                  <https://github.com/Kim-J-Smith/Simple-Button>
+ */
+#include    "sBtn_matrix.h"
+#include    <stdio.h>
+#include    <stdlib.h>
+#include    <string.h>
+
+#define BENCH_SCANS         200000U
+
+SIMPLEBTN__MATRIX_CREATE(8, 8, BM8)
+SIMPLEBTN__MATRIX_CREATE(16, 16, BM16)
+
+/* The simulated keys : bit C of g_pushed[R] is key (R, C), active-low columns, with diodes */
+static uint32_t g_pushed[32];
+static uint8_t g_row;
+static uint32_t g_cost[BENCH_SCANS];
+
+static void bench_SelectRow(uint8_t row) { g_row = row; }
+static uint32_t bench_ReadColumns(void) { return ~g_pushed[g_row]; }
+
+static void bench_ShortPush(void) { }
+static void bench_LongPush(uint32_t time) { (void)time; }
+static void bench_RepeatPush(uint8_t count) { (void)count; }
+
+static int bench_Compare(const void* a, const void* b)
+{
+    const uint32_t x = *(const uint32_t*)a, y = *(const uint32_t*)b;
+    return (x > y) - (x < y);
+}
+
+static void
+bench_Run(SimpleButton_Type_Matrix_t* const matrix, uint8_t size, const char* const name)
+{
+    static const char* const cases[] = { "idle", "1 key", "1 row", "all keys" };
+    uint32_t c, i, r;
+
+    for (c = 0; c < 4; c++) {
+        uint64_t total = 0;
+
+        memset(g_pushed, 0, sizeof(g_pushed));
+        for (r = 0; r < size; r++) {
+            if (c == 3 || (c == 2 && r == 0)) {
+                g_pushed[r] = (size >= 32U) ? 0xFFFFFFFFU : ((1UL << size) - 1U);
+            }
+        }
+        if (c == 1) {
+            g_pushed[size / 2U] = 1UL << (size / 2U);
+        }
+
+        for (i = 0; i < BENCH_SCANS; i++) {
+            uint64_t begin, used;
+
+            SimpleButton_Posix_SetTime((uint64_t)i * 1000U); /* one scan per ms */
+
+            begin = SimpleButton_Posix_GetNs();
+            SimpleButton_Matrix_Handler(matrix);
+            used = SimpleButton_Posix_GetNs() - begin;
+
+            total += used;
+            g_cost[i] = (uint32_t)used;
+        }
+
+        qsort(g_cost, BENCH_SCANS, sizeof(g_cost[0]), bench_Compare);
+        printf("%-6s %-9s mean %7.1f ns/scan (%5.2f ns/key), median %6u ns, 99.9%% %6u ns\n",
+            name, cases[c], (double)total / BENCH_SCANS,
+            (double)total / BENCH_SCANS / ((double)size * size),
+            g_cost[BENCH_SCANS / 2U], g_cost[BENCH_SCANS - BENCH_SCANS / 1000U]);
+    }
+}
+
+int main(void)
+{
+    SimpleButton_Type_MatrixConfig_t config;
+
+    config.selectRow = bench_SelectRow;
+    config.unselectRow = 0;
+    config.readColumns = bench_ReadColumns;
+    config.columnInvert = 0xFFFFFFFFU;
+    config.hasDiodes = 1;
+
+    SimpleButton_Posix_SetClock(SimpleButton_PosixClock_Virtual);
+
+    SimpleButton_BM8_Init(&config);
+    SIMPLEBTN__MATRIX_SETCALLBACK(SimpleButton_BM8, bench_ShortPush, bench_LongPush, bench_RepeatPush);
+    bench_Run(&SimpleButton_BM8, 8, "8x8");
+
+    SimpleButton_BM16_Init(&config);
+    SIMPLEBTN__MATRIX_SETCALLBACK(SimpleButton_BM16, bench_ShortPush, bench_LongPush, bench_RepeatPush);
+    bench_Run(&SimpleButton_BM16, 16, "16x16");
+
+    return 0;
+}
@@ -0,0 +1,166 @@
+/**
+ * @file            bench_shard.c
+ *
+ * @author          Kim-J-Smith
+ *
+ * @brief           Host benchmark of the sharded handler : the cost of one pass
+ *                  over 4096 dynamic-buttons with 1, 2, 4 .. N threads, when
+ *                  all of them are idle, 1 in 64 and all of them are clicked.
+ *                  The plain loop (with and without a lock) is the reference,
+ *                  and the short pushes must be the same in every run.
+ *
+ * @version         0.1.0 ( 0001L )
+ *
+ * @date            2025-10-03
+ *
+ * @attention       Copyright (c) 2025 Kim-J-Smith.
+ *                  All rights reserved.
+ *
+ * @copyright       SPDX-License-Identifier: MIT
+ *                  Refer to the LICENCE file in root for more details.
+ *                  <https://github.com/Kim-J-Smith/Simple-Button>
+ */
+#include    "sBtn_posix_shard.h"
+#include    "sBtn_posix_test.h"
+#include    <stdlib.h>
+#include    <unistd.h>
+
+#define BENCH_BUTTONS       4096
+#define BENCH_SHARDS        64
+#define BENCH_PASSES        100     /* passes pushed, then passes released */
+#define BENCH_ROUNDS        5
+#define BENCH_MAX_THREADS   8       /* or the first argument */
+#define BENCH_IRQ_BUTTON    1000    /* its EXTI is raised while its pin reads idle */
+
+static SimpleButton_Type_DynamicBtn_t g_buttons[BENCH_BUTTONS];
+static SimpleButton_Type_Shard_t g_shards[BENCH_SHARDS];
+static SimpleButton_Type_ShardSet_t g_set;
+
+static uint32_t g_short;
+static uint64_t g_time_us;
+
+static void bench_ShortPush(void) { __atomic_fetch_add(&g_short, 1, __ATOMIC_RELAXED); }
+
+static void bench_ButtonIRQ(void) { simpleButton_Private_InterruptHandler(&(g_buttons[BENCH_IRQ_BUTTON].Private)); }
+
+static void
+bench_InitButtons(void)
+{
+    uint32_t i;
+
+    for (i = 0; i < BENCH_BUTTONS; i++) {
+        SimpleButton_Posix_WritePin(i / 16, (uint16_t)(1U << (i % 16)), 1);
+        SimpleButton_DynamicButton_Init(&(g_buttons[i]), i / 16, (uint16_t)(1U << (i % 16)), 1);
+    }
+    g_short = 0;
+}
+
+static void
+bench_Press(uint32_t every, uint8_t level)
+{
+    uint32_t i;
+
+    for (i = 0; i < BENCH_BUTTONS; i += every) {
+        SimpleButton_Posix_WritePin(i / 16, (uint16_t)(1U << (i % 16)), level);
+    }
+}
+
+static void
+bench_PassPlain(void)
+{
+    uint32_t i;
+
+    for (i = 0; i < BENCH_BUTTONS; i++) {
+        SimpleButton_DynamicButton_Handler(&(g_buttons[i]), bench_ShortPush, 0, 0);
+    }
+}
+
+static void bench_PassShard(void) { SimpleButton_Shard_HandleAll(&g_set); }
+
+/* mean us of one pass, while 1 button in `every` is clicked every 2 * BENCH_PASSES passes */
+static double
+bench_Load(void (* pass)(void), uint32_t every)
+{
+    uint64_t begin;
+    uint32_t r, p;
+    uint8_t level;
+
+    begin = SimpleButton_Posix_GetNs();
+    for (r = 0; r < BENCH_ROUNDS; r++) {
+        for (level = 0; level < 2; level++) {
+            bench_Press(every, level);
+            for (p = 0; p < BENCH_PASSES; p++) {
+                SimpleButton_Posix_SetTime(g_time_us += 1000U);
+                pass();
+            }
+        }
+    }
+
+    return (double)(SimpleButton_Posix_GetNs() - begin) / 1000.0 / (BENCH_ROUNDS * 2 * BENCH_PASSES);
+}
+
+int main(int argc, char* argv[])
+{
+    pthread_mutexattr_t attr;
+    pthread_mutex_t lock;
+    uint32_t expected;
+    uint32_t maxThreads = (argc > 1) ? (uint32_t)atoi(argv[1]) : BENCH_MAX_THREADS;
+    uint32_t t;
+
+    if (maxThreads < 1 || maxThreads > SIMPLEBTN_POSIX_SHARD_MAX_THREADS) {
+        maxThreads = BENCH_MAX_THREADS;
+    }
+
+    printf("%ld CPU(s) online, 1 .. %u thread(s)\n", sysconf(_SC_NPROCESSORS_ONLN), maxThreads);
+    SimpleButton_Posix_SetClock(SimpleButton_PosixClock_Virtual);
+
+    bench_InitButtons();
+    printf("plain loop   : idle %7.1f us/pass, 1/64 clicked %7.1f, all clicked %7.1f\n",
+        bench_Load(bench_PassPlain, BENCH_BUTTONS), bench_Load(bench_PassPlain, 64),
+        bench_Load(bench_PassPlain, 1));
+    expected = g_short;
+
+    pthread_mutexattr_init(&attr);
+    pthread_mutexattr_settype(&attr, PTHREAD_MUTEX_RECURSIVE);
+    pthread_mutex_init(&lock, &attr);
+    bench_InitButtons();
+    SimpleButton_Posix_SetThreadLock(&lock);
+    printf("plain, 1 lock: idle %7.1f us/pass, 1/64 clicked %7.1f, all clicked %7.1f\n",
+        bench_Load(bench_PassPlain, BENCH_BUTTONS), bench_Load(bench_PassPlain, 64),
+        bench_Load(bench_PassPlain, 1));
+    SimpleButton_Posix_SetThreadLock(0);
+    SIMPLEBTN_TEST_CHECK(g_short == expected);
+
+    for (t = 1; t <= maxThreads; t *= 2) {
+        SimpleButton_Type_Shard_t* const irqShard = &(g_shards[BENCH_IRQ_BUTTON * BENCH_SHARDS / BENCH_BUTTONS]);
+        uint64_t skipped = 0, passes = 0, irqPasses;
+        double idle, some, all;
+        uint32_t s;
+
+        bench_InitButtons();
+        SimpleButton_Shard_Init(&g_set, g_shards, BENCH_SHARDS, g_buttons, BENCH_BUTTONS, t);
+        g_set.callBacks.shortPushCallBack = bench_ShortPush;
+
+        idle = bench_Load(bench_PassShard, BENCH_BUTTONS);
+        some = bench_Load(bench_PassShard, 64);
+        all = bench_Load(bench_PassShard, 1);
+
+        for (s = 0; s < BENCH_SHARDS; s++) {
+            skipped += g_shards[s].skipped;
+            passes += g_shards[s].passes;
+        }
+        printf("%2u thread(s) : idle %7.1f us/pass, 1/64 clicked %7.1f, all clicked %7.1f (%.0f%% shards skipped)\n",
+            t, idle, some, all, 100.0 * (double)skipped / (double)(skipped + passes));
+        SIMPLEBTN_TEST_CHECK(g_short == expected);
+
+        /* all idle : the shard taken by the EXTI is handled, not skipped */
+        irqPasses = irqShard->passes;
+        SimpleButton_Shard_RaiseIRQ(&g_set, BENCH_IRQ_BUTTON, bench_ButtonIRQ);
+        SimpleButton_Shard_HandleAll(&g_set);
+        SIMPLEBTN_TEST_CHECK(irqShard->passes == irqPasses + 1U);
+
+        SimpleButton_Shard_Deinit(&g_set);
+    }
+
+    return SIMPLEBTN_TEST_RESULT();
+}
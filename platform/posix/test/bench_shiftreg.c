@@ -0,0 +1,119 @@
+/**
+ * @file            bench_shiftreg.c
+ *
+ * @author          Kim-J-Smith
+ *
+ * @brief           Host benchmark of the 74HC165 sampler : the cost of one scan
+ *                  with the SPI burst and with bit-banging, at 8/32/64 keys.
+ *                  Every chain is checked first : the inputs past the chain
+ *                  read as pushed and must not be sampled, then one press of
+ *                  the first, the 10th and the last key gives one short push.
+ *
+ * @version         0.1.0 ( 0001L )
+ *
+ * @date            2025-10-03
+ *
+ * @attention       Copyright (c) 2025 Kim-J-Smith.
+ *                  All rights reserved.
+ *
+ * @copyright       SPDX-License-Identifier: MIT
+ *                  Refer to the LICENCE file in root for more details.
+ *                  <https://github.com/Kim-J-Smith/Simple-Button>
+ */
+#include    "sBtn_shiftreg.h"
+#include    "sBtn_posix_test.h"
+
+#define BENCH_MAX_KEYS      64
+#define BENCH_CHAIN_BITS    256 /* inputs of the simulated chain */
+#define BENCH_SCANS         200000U
+
+SIMPLEBTN__INPUTSCAN_CREATE(BENCH_MAX_KEYS, 1, SR)
+
+static uint8_t g_buffer[BENCH_MAX_KEYS / 8];
+static SimpleButton_Type_InputSource_t g_source[1];
+static uint32_t g_short[BENCH_MAX_KEYS];
+
+static SimpleButton_Type_ShiftRegChain_t g_burst = {
+    SimpleButton_Posix_ShiftRegLoad, SimpleButton_Posix_ShiftRegBurst, 0, 0, g_buffer, 1
+};
+
+static SimpleButton_Type_ShiftRegChain_t g_bitbang = {
+    SimpleButton_Posix_ShiftRegLoad, 0, SimpleButton_Posix_ShiftRegReadData,
+    SimpleButton_Posix_ShiftRegClock, 0, 1
+};
+
+static void bench_ShortPush(void) { g_short[SimpleButton_InputScan_CurrentKey(&SimpleButton_SR)] ++; }
+static void bench_LongPush(uint32_t time) { (void)time; }
+static void bench_RepeatPush(uint8_t count) { (void)count; }
+
+static void bench_Scan(void* arg) { (void)arg; SimpleButton_InputScan_Handler(&SimpleButton_SR); }
+
+static void
+bench_Press(uint16_t inputCount, uint8_t level)
+{
+    SimpleButton_Posix_WriteShiftRegInput(0, level);
+    SimpleButton_Posix_WriteShiftRegInput(9, level);
+    SimpleButton_Posix_WriteShiftRegInput((uint16_t)(inputCount - 1U), level);
+}
+
+static void
+bench_Run(SimpleButton_Type_ShiftRegChain_t* const chain, uint16_t inputCount)
+{
+    uint32_t bitmap[BENCH_MAX_KEYS / 32] = { 0 };
+    uint64_t ns;
+    uint32_t t;
+    uint16_t i;
+
+    g_source[0].sampleAll = SimpleButton_Source_SampleShiftReg;
+    g_source[0].context = chain;
+    g_source[0].inputCount = inputCount;
+
+    /* released keys read 1, the unpopulated inputs past the chain read 0 */
+    for (i = 0; i < BENCH_CHAIN_BITS; i++) {
+        SimpleButton_Posix_WriteShiftRegInput(i, (uint8_t)(i < inputCount ? 1U : 0U));
+    }
+
+    /* the sampler alone : nothing is pushed */
+    SimpleButton_Source_SampleShiftReg(chain, bitmap, inputCount);
+    SIMPLEBTN_TEST_CHECK(bitmap[0] == 0 && bitmap[1] == 0);
+
+    SimpleButton_SR_Init(g_source, 1);
+    SIMPLEBTN__INPUTSCAN_SETCALLBACK(SimpleButton_SR, bench_ShortPush, bench_LongPush, bench_RepeatPush);
+    for (i = 0; i < BENCH_MAX_KEYS; i++) {
+        g_short[i] = 0;
+    }
+
+    for (t = 0; t < 1000; t++) {
+        SimpleButton_Posix_SetTime((uint64_t)t * 1000U);
+        if (t == 100) {
+            bench_Press(inputCount, 0);
+        } else if (t == 200) {
+            bench_Press(inputCount, 1);
+        }
+        bench_Scan(0);
+    }
+
+    SIMPLEBTN_TEST_CHECK(g_short[0] == 1);
+    SIMPLEBTN_TEST_CHECK(inputCount <= 9 || g_short[9] == 1);
+    SIMPLEBTN_TEST_CHECK(g_short[inputCount - 1U] == 1);
+    SIMPLEBTN_TEST_CHECK(SimpleButton_InputScan_AllIdle(&SimpleButton_SR) != 0);
+
+    ns = SimpleButton_Posix_MeasureNs(bench_Scan, 0, BENCH_SCANS);
+    printf("%-8s %2u keys : %5llu ns/scan, %6.2f ns/key\n", chain->burst ? "burst" : "bit-bang",
+        inputCount, (unsigned long long)ns, (double)ns / inputCount);
+}
+
+int main(void)
+{
+    static const uint16_t sizes[] = { 8, 12, 32, 64 };
+    uint32_t i;
+
+    SimpleButton_Posix_SetClock(SimpleButton_PosixClock_Virtual);
+
+    for (i = 0; i < sizeof(sizes) / sizeof(sizes[0]); i++) {
+        bench_Run(&g_burst, sizes[i]);
+        bench_Run(&g_bitbang, sizes[i]);
+    }
+
+    return SIMPLEBTN_TEST_RESULT();
+}
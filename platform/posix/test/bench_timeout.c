@@ -0,0 +1,242 @@
+/**
+ * @file            bench_timeout.c
+ *
+ * @author          Kim-J-Smith
+ *
+ * @brief           Host driver of the timeout engine, built once for each
+ *                  vector path (bench_timeout_avx2 / _sse2 / _scalar) :
+ *                  - checks `simpleButton_Private_Timeout_Expired()` against
+ *                    the signed compare on deadlines around the wrap-around
+ *                    of the tick and of the 2^31 window;
+ *                  - measures it against the scalar loop over the deadlines;
+ *                  - measures the engine against the scalar loop over all the
+ *                    keys, which must give the same events.
+ *
+ * @version         0.1.0 ( 0001L )
+ *
+ * @date            2025-10-03
+ *
+ * @attention       Copyright (c) 2025 Kim-J-Smith.
+ *                  All rights reserved.
+ *
+ * @copyright       SPDX-License-Identifier: MIT
+ *                  Refer to the LICENCE file in root for more details.
+ *                  <https://github.com/Kim-J-Smith/Simple-Button>
+ */
+#include    "sBtn_timeout.c" /* the static helpers (this file is not linked again) */
+#include    "sBtn_posix_test.h"
+
+#define BENCH_KEYS          4096
+#define BENCH_TICKS         5000U
+#define BENCH_CHECKS        200000U
+
+SIMPLEBTN__TIMEOUT_CREATE(BENCH_KEYS, TE)
+
+static simpleButton_Type_VirtualKey_t g_reference[BENCH_KEYS];
+static uint32_t g_pushed[BENCH_KEYS / 32];
+static uint32_t g_deadline[BENCH_KEYS];
+
+static uint32_t g_seed = 2025;
+static uint64_t g_hash;
+static uint32_t g_events;
+static uint16_t g_referenceKey;
+static uint8_t g_is_reference;
+
+static uint32_t bench_Random(void)
+{
+    g_seed = g_seed * 1103515245U + 12345U;
+    return (g_seed >> 8) ^ (g_seed << 20);
+}
+
+/* the scalar loop : one signed compare per key */
+static uint32_t
+bench_ExpiredScalar(const uint32_t* const deadline, const uint32_t now)
+{
+    uint32_t expired = 0;
+    uint32_t i;
+
+    for (i = 0; i < 32U; i++) {
+        if ((int32_t)(now - deadline[i]) >= 0) {
+            expired |= (1UL << i);
+        }
+    }
+
+    return expired;
+}
+
+static void
+bench_CheckWrapAround(void)
+{
+    static const uint32_t nows[] = {
+        0x00000000U, 0x00000001U, 0x7FFFFFFFU, 0x80000000U, 0x80000001U, 0xFFFFFFF0U, 0xFFFFFFFFU,
+    };
+    static const uint32_t deltas[] = {
+        0x80000000U, 0x80000001U, 0xFFFFFFFFU, 0x00000000U, 0x00000001U, 0x7FFFFFFFU,
+    };
+    uint32_t n, k, round;
+
+    for (n = 0; n < sizeof(nows) / sizeof(nows[0]) + 1U; n++) {
+        for (round = 0; round < 1000U; round++) {
+            const uint32_t now = (n < sizeof(nows) / sizeof(nows[0])) ? nows[n] : bench_Random();
+
+            for (k = 0; k < 32U; k++) {
+                const uint32_t delta = (bench_Random() & 1U) ?
+                    deltas[bench_Random() % (sizeof(deltas) / sizeof(deltas[0]))] : bench_Random();
+                g_deadline[k] = now + delta;
+            }
+
+            SIMPLEBTN_TEST_CHECK(simpleButton_Private_Timeout_Expired(g_deadline, now)
+                == bench_ExpiredScalar(g_deadline, now));
+        }
+    }
+}
+
+static void
+bench_CompareExpired(void)
+{
+    volatile uint32_t sink = 0;
+    uint64_t begin, vector, scalar;
+    uint32_t i, w;
+
+    for (i = 0; i < BENCH_KEYS; i++) {
+        g_deadline[i] = bench_Random();
+    }
+
+    begin = SimpleButton_Posix_GetNs();
+    for (i = 0; i < BENCH_CHECKS / (BENCH_KEYS / 32); i++) {
+        for (w = 0; w < BENCH_KEYS / 32; w++) {
+            sink += simpleButton_Private_Timeout_Expired(&(g_deadline[32U * w]), i);
+        }
+    }
+    vector = SimpleButton_Posix_GetNs() - begin;
+
+    begin = SimpleButton_Posix_GetNs();
+    for (i = 0; i < BENCH_CHECKS / (BENCH_KEYS / 32); i++) {
+        for (w = 0; w < BENCH_KEYS / 32; w++) {
+            sink += bench_ExpiredScalar(&(g_deadline[32U * w]), i);
+        }
+    }
+    scalar = SimpleButton_Posix_GetNs() - begin;
+
+    (void)sink;
+    printf("  Expired (32 keys) : %5.2f ns, scalar loop %5.2f ns\n",
+        (double)vector / BENCH_CHECKS, (double)scalar / BENCH_CHECKS);
+}
+
+static uint16_t
+bench_CurrentKey(void)
+{
+    return g_is_reference ? g_referenceKey : SimpleButton_Timeout_CurrentKey(&SimpleButton_TE);
+}
+
+static void bench_Record(uint32_t kind)
+{
+    g_hash = g_hash * 1000003U + bench_CurrentKey() * 7919U + kind + SimpleButton_Posix_GetTick();
+    g_events ++;
+}
+
+static void bench_ShortPush(void) { bench_Record(1); }
+static void bench_LongPush(uint32_t time) { (void)time; bench_Record(2); }
+static void bench_RepeatPush(uint8_t count) { bench_Record(3U + count); }
+
+/* key K of 1 in `every` is pushed for a while, again and again */
+static void
+bench_Sample(uint32_t t, uint32_t every)
+{
+    uint32_t w, b;
+
+    for (w = 0; w < BENCH_KEYS / 32; w++) {
+        uint32_t mask = 0;
+
+        for (b = 0; b < 32U; b++) {
+            const uint32_t k = 32U * w + b;
+            uint32_t period, hold;
+
+            if (k % every != 0) {
+                continue;
+            }
+            hold = (k % 3U == 0) ? 1500U : 60U + (k % 5U) * 20U;
+            period = 400U + (k % 7U) * 150U + hold;
+            if ((t + k * 13U) % period < hold) {
+                mask |= 1UL << b;
+            }
+        }
+        g_pushed[w] = mask;
+    }
+}
+
+static void
+bench_CompareEngine(uint32_t every)
+{
+    uint64_t hash, scalar = 0, engine = 0;
+    uint32_t events;
+    uint32_t t, k;
+
+    SimpleButton_TE_Init();
+    SIMPLEBTN__TIMEOUT_SETCALLBACK(SimpleButton_TE, bench_ShortPush, bench_LongPush, bench_RepeatPush);
+    for (k = 0; k < BENCH_KEYS; k++) {
+        simpleButton_Private_InitStructPrivate(&(g_reference[k].Private));
+        simpleButton_Private_InitStructPublic(&(g_reference[k].Public));
+    }
+
+    /* the reference : the scalar loop, every key in every pass */
+    g_is_reference = 1;
+    g_hash = 0;
+    g_events = 0;
+    for (t = 0; t < BENCH_TICKS; t++) {
+        uint64_t begin;
+
+        SimpleButton_Posix_SetTime((uint64_t)t * 1000U + 1000000U);
+        bench_Sample(t, every);
+
+        begin = SimpleButton_Posix_GetNs();
+        for (k = 0; k < BENCH_KEYS; k++) {
+            g_referenceKey = (uint16_t)k;
+            simpleButton_Private_PolledHandler(&(g_reference[k].Private), &(g_reference[k].Public),
+                (uint8_t)((g_pushed[k / 32U] >> (k % 32U)) & 1U),
+                bench_ShortPush, bench_LongPush, bench_RepeatPush, 0);
+        }
+        scalar += SimpleButton_Posix_GetNs() - begin;
+    }
+    hash = g_hash;
+    events = g_events;
+
+    g_is_reference = 0;
+    g_hash = 0;
+    g_events = 0;
+    for (t = 0; t < BENCH_TICKS; t++) {
+        uint64_t begin;
+
+        SimpleButton_Posix_SetTime((uint64_t)t * 1000U + 1000000U);
+        bench_Sample(t, every);
+
+        begin = SimpleButton_Posix_GetNs();
+        SimpleButton_Timeout_Handler(&SimpleButton_TE, g_pushed);
+        engine += SimpleButton_Posix_GetNs() - begin;
+    }
+
+    SIMPLEBTN_TEST_CHECK(g_events == events && g_hash == hash);
+    printf("  1/%-2u keys moving : engine %7.1f us/pass, scalar loop %7.1f us/pass (%u events)\n",
+        every, (double)engine / BENCH_TICKS / 1000.0, (double)scalar / BENCH_TICKS / 1000.0, events);
+}
+
+int main(void)
+{
+#if SIMPLEBTN_TIMEOUT_LANES_ == 8U
+    if (!__builtin_cpu_supports("avx2")) {
+        printf("%s: no AVX2 on this CPU, skipped\n", __FILE__);
+        return 0;
+    }
+#endif /* SIMPLEBTN_TIMEOUT_LANES_ == 8U */
+
+    printf("%u lane(s) :\n", (unsigned)SIMPLEBTN_TIMEOUT_LANES_);
+    SimpleButton_Posix_SetClock(SimpleButton_PosixClock_Virtual);
+
+    bench_CheckWrapAround();
+    bench_CompareExpired();
+    bench_CompareEngine(1);
+    bench_CompareEngine(8);
+    bench_CompareEngine(64);
+
+    return SIMPLEBTN_TEST_RESULT();
+}
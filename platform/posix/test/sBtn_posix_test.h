@@ -0,0 +1,40 @@
+/**
+ * @file            sBtn_posix_test.h
+ *
+ * @author          Kim-J-Smith
+ *
+ * @brief           Tiny check macros shared by the host tests.
+ *
+ * @version         0.1.0 ( 0001L )
+ *
+ * @date            2025-10-03
+ *
+ * @attention       Copyright (c) 2025 Kim-J-Smith.
+ *                  All rights reserved.
+ *
+ * @copyright       SPDX-License-Identifier: MIT
+ *                  Refer to the LICENCE file in root for more details.
+ *                  <https://github.com/Kim-J-Smith/Simple-Button>
+ */
+#ifndef     SIMPLEBUTTON_POSIX_TEST_H__
+#define     SIMPLEBUTTON_POSIX_TEST_H__     0001L
+
+#include    <stdio.h>
+
+static unsigned int g_test_failed = 0;
+
+/* Report a failed check and go on */
+#define SIMPLEBTN_TEST_CHECK(cond)                                              \
+    do {                                                                        \
+        if (!(cond)) {                                                          \
+            printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond);     \
+            g_test_failed ++;                                                   \
+        }                                                                       \
+    } while (0)
+
+/* The exit code of a test */
+#define SIMPLEBTN_TEST_RESULT()                                                 \
+    (printf("%s: %s\n", __FILE__, (g_test_failed == 0) ? "PASS" : "FAIL"),     \
+     (g_test_failed == 0) ? 0 : 1)
+
+#endif /* SIMPLEBUTTON_POSIX_TEST_H__ */
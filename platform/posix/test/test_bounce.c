@@ -0,0 +1,121 @@
+/**
+ * @file            test_bounce.c
+ *
+ * @author          Kim-J-Smith
+ *
+ * @brief           Host regression test : replay seeded bounce traces through
+ *                  EXTI and dynamic buttons, and check that every simulated
+ *                  press gives exactly one short / long / repeat push.
+ *
+ * @version         0.1.0 ( 0001L )
+ *
+ * @date            2025-10-03
+ *
+ * @attention       Copyright (c) 2025 Kim-J-Smith.
+ *                  All rights reserved.
+ *
+ * @copyright       SPDX-License-Identifier: MIT
+ *                  Refer to the LICENCE file in root for more details.
+ *                  <https://github.com/Kim-J-Smith/Simple-Button>
+ */
+#include    "sBtn_posix_bounce.h"
+#include    "sBtn_posix_test.h"
+
+SIMPLEBTN__CREATE(0, 0x0001, SIMPLEBTN_EXTI_TRIGGER_FALLING, TB0)
+SIMPLEBTN__CREATE(0, 0x0002, SIMPLEBTN_EXTI_TRIGGER_FALLING, TB1)
+SIMPLEBTN__CREATE(0, 0x0004, SIMPLEBTN_EXTI_TRIGGER_FALLING, TB2)
+SIMPLEBTN__CREATE(0, 0x0008, SIMPLEBTN_EXTI_TRIGGER_FALLING, TB3)
+
+#define TEST_DYNAMIC_NUM    4
+#define TEST_CHANNEL_NUM    (4 + TEST_DYNAMIC_NUM)
+#define TEST_NO_HOLD        10000U  /* longer than every simulated press */
+
+static SimpleButton_Type_DynamicBtn_t g_dynamic[TEST_DYNAMIC_NUM];
+static SimpleButton_Type_BounceChannel_t g_channels[TEST_CHANNEL_NUM];
+
+static uint32_t g_short, g_long, g_repeat_clicks;
+
+static void test_ShortPush(void) { g_short ++; }
+static void test_LongPush(uint32_t time) { (void)time; g_long ++; }
+static void test_RepeatPush(uint8_t count) { g_repeat_clicks += count; }
+
+/* Run one seeded trace, then let the buttons finish their last press. */
+static uint64_t
+test_RunTrace(const SimpleButton_Type_BounceConfig_t* const config, uint32_t seed, uint64_t duration_us)
+{
+    SimpleButton_Type_BounceSim_t sim;
+    uint32_t i;
+
+    g_short = g_long = g_repeat_clicks = 0;
+
+    SimpleButton_TB0_Init();
+    SimpleButton_TB1_Init();
+    SimpleButton_TB2_Init();
+    SimpleButton_TB3_Init();
+
+    SimpleButton_Bounce_Init(&sim, g_channels, TEST_CHANNEL_NUM, config, seed);
+    SimpleButton_Bounce_BindButton(&sim, 0, &SimpleButton_TB0, 0, 0x0001, 1);
+    SimpleButton_Bounce_BindButton(&sim, 1, &SimpleButton_TB1, 0, 0x0002, 1);
+    SimpleButton_Bounce_BindButton(&sim, 2, &SimpleButton_TB2, 0, 0x0004, 1);
+    SimpleButton_Bounce_BindButton(&sim, 3, &SimpleButton_TB3, 0, 0x0008, 1);
+    for (i = 0; i < TEST_DYNAMIC_NUM; i++) {
+        SimpleButton_DynamicButton_Init(&g_dynamic[i], 1, (uint16_t)(1U << i), 1);
+        SimpleButton_Bounce_BindDynamicButton(&sim, 4 + i, &g_dynamic[i]);
+    }
+    for (i = 0; i < TEST_CHANNEL_NUM; i++) {
+        SimpleButton_Bounce_SetCallBack(&sim, i, test_ShortPush, test_LongPush, test_RepeatPush);
+        /* one long push for each press, no hold-push after it */
+        if (g_channels[i].dynamicButton != 0) {
+            g_channels[i].dynamicButton->Public.holdPushMinTime = TEST_NO_HOLD;
+        } else {
+            g_channels[i].button->Public.holdPushMinTime = TEST_NO_HOLD;
+        }
+    }
+
+    SimpleButton_Bounce_Run(&sim, duration_us, 1000);
+
+    /* no new press after the ones already scheduled, then drain them */
+    sim.config.gapMin_us = sim.config.gapMax_us = 0xFFFFFFFFU;
+    SimpleButton_Bounce_Run(&sim, (uint64_t)config->gapMax_us + config->holdMax_us + 2000000U, 1000);
+
+    return sim.stats.presses;
+}
+
+int main(void)
+{
+    SimpleButton_Type_BounceConfig_t config;
+    uint64_t presses;
+
+    /* separated short presses, with EMI spikes */
+    SimpleButton_Bounce_DefaultConfig(&config);
+    config.gapMin_us = 400000;
+    config.emiInterval_us = 50000;
+    presses = test_RunTrace(&config, 1234, 60000000U);
+    SIMPLEBTN_TEST_CHECK(presses > 100);
+    SIMPLEBTN_TEST_CHECK(g_short == presses);
+    SIMPLEBTN_TEST_CHECK(g_long == 0 && g_repeat_clicks == 0);
+
+    /* long presses */
+    SimpleButton_Bounce_DefaultConfig(&config);
+    config.holdMin_us = 1200000;
+    config.holdMax_us = 1900000;
+    config.gapMin_us = 400000;
+    presses = test_RunTrace(&config, 42, 60000000U);
+    SIMPLEBTN_TEST_CHECK(presses > 50);
+    SIMPLEBTN_TEST_CHECK(g_long == presses);
+    SIMPLEBTN_TEST_CHECK(g_short == 0 && g_repeat_clicks == 0);
+
+    /* fast clicks : every click is in a short push or a repeat push */
+    SimpleButton_Bounce_DefaultConfig(&config);
+    config.holdMin_us = 60000;
+    config.holdMax_us = 120000;
+    config.gapMin_us = 80000;
+    config.gapMax_us = 500000;
+    presses = test_RunTrace(&config, 7, 60000000U);
+    SIMPLEBTN_TEST_CHECK(presses > 500);
+    SIMPLEBTN_TEST_CHECK(g_repeat_clicks > 0);
+    SIMPLEBTN_TEST_CHECK(g_short + g_repeat_clicks == presses);
+    SIMPLEBTN_TEST_CHECK(g_long == 0);
+
+    return SIMPLEBTN_TEST_RESULT();
+}
@@ -0,0 +1,104 @@
+/**
+ * @file            sBtn_stm32_dma.c
+ *
+ * @author          Kim-J-Smith
+ *
+ * @brief           Source file of the STM32 HAL hooks of the DMA scanning
+ *                  engine.
+ *
+ * @version         0.1.0 ( 0001L )
+ *
+ * @date            2025-10-03
+ *
+ * @attention       Copyright (c) 2025 Kim-J-Smith.
+ *                  All rights reserved.
+ *
+ * @copyright       SPDX-License-Identifier: MIT
+ *                  Refer to the LICENCE file in root for more details.
+ *                  <https://github.com/Kim-J-Smith/Simple-Button>
+ */
+#include    "sBtn_stm32_dma.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+static void simpleButton_Stm32_DmaHalfCplt(DMA_HandleTypeDef* hdma)
+{
+    SimpleButton_Type_Stm32DmaLink_t* const link = (SimpleButton_Type_Stm32DmaLink_t*)hdma->Parent;
+
+    SimpleButton_DmaScan_TransferEvent(link->scanner, 0);
+}
+
+static void simpleButton_Stm32_DmaCplt(DMA_HandleTypeDef* hdma)
+{
+    SimpleButton_Type_Stm32DmaLink_t* const link = (SimpleButton_Type_Stm32DmaLink_t*)hdma->Parent;
+
+    SimpleButton_DmaScan_TransferEvent(link->scanner, 1);
+}
+
+/**
+ * @brief   Start the DMA channels, then the timer. Only the channel of port 0
+ *          raises interrupts : all the channels are triggered by the same
+ *          timer period, so their buffers are filled together.
+ */
+void
+SimpleButton_Stm32_DmaStart(
+    void* context,
+    const SimpleButton_Type_DmaPort_t* ports,
+    uint8_t portCount,
+    volatile uint16_t* buffer,
+    uint16_t depth
+) {
+    SimpleButton_Type_Stm32DmaLink_t* const link = (SimpleButton_Type_Stm32DmaLink_t*)context;
+    uint8_t port;
+
+    if (portCount > SIMPLEBTN_STM32_DMA_MAX_PORTS) {
+#if defined(SIMPLEBTN_DEBUG)
+        SIMPLEBTN_FUNC_PANIC(
+            "too many ports in func:SimpleButton_Stm32_DmaStart",
+            simpleButton_ErrorNum_invalidInput,
+        );
+#endif /* defined(SIMPLEBTN_DEBUG) */
+        portCount = SIMPLEBTN_STM32_DMA_MAX_PORTS; /* the other ports are not sampled */
+    }
+
+    for (port = 0; port < portCount; port++) {
+        DMA_HandleTypeDef* const hdma = link->hdma[port];
+        const uint32_t src = (uint32_t)&(((GPIO_TypeDef*)(ports[port].GPIO_Base))->IDR);
+        const uint32_t dst = (uint32_t)&(buffer[(uint32_t)port * depth]);
+
+        if (port == 0) {
+            hdma->Parent = link;
+            hdma->XferHalfCpltCallback = simpleButton_Stm32_DmaHalfCplt;
+            hdma->XferCpltCallback = simpleButton_Stm32_DmaCplt;
+            HAL_DMA_Start_IT(hdma, src, dst, depth);
+        } else {
+            HAL_DMA_Start(hdma, src, dst, depth);
+        }
+
+        __HAL_TIM_ENABLE_DMA(link->htim, link->dmaSource[port]);
+    }
+
+    HAL_TIM_Base_Start(link->htim);
+}
+
+void
+SimpleButton_Stm32_DmaStop(void* context)
+{
+    SimpleButton_Type_Stm32DmaLink_t* const link = (SimpleButton_Type_Stm32DmaLink_t*)context;
+    uint8_t port;
+
+    HAL_TIM_Base_Stop(link->htim);
+
+    for (port = 0; port < SIMPLEBTN_STM32_DMA_MAX_PORTS; port++) {
+        if (link->hdma[port] != 0) {
+            __HAL_TIM_DISABLE_DMA(link->htim, link->dmaSource[port]);
+            HAL_DMA_Abort(link->hdma[port]);
+        }
+    }
+}
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
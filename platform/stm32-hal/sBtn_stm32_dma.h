@@ -0,0 +1,75 @@
+/**
+ * @file            sBtn_stm32_dma.h
+ *
+ * @author          Kim-J-Smith
+ *
+ * @brief           Header file of the STM32 HAL hooks of the DMA scanning
+ *                  engine (see "sBtn_dma.h"). One timer triggers one DMA
+ *                  channel per GPIO port (update / CC1 ~ CC4 requests), which
+ *                  copies GPIOx->IDR into the circular buffer.
+ *
+ * @version         0.1.0 ( 0001L )
+ *
+ * @date            2025-10-03
+ *
+ * @attention       Copyright (c) 2025 Kim-J-Smith.
+ *                  All rights reserved.
+ *
+ * @copyright       SPDX-License-Identifier: MIT
+ *                  Refer to the LICENCE file in root for more details.
+ *                  <https://github.com/Kim-J-Smith/Simple-Button>
+ */
+#ifndef     SIMPLEBUTTON_STM32_DMA_H__
+#define     SIMPLEBUTTON_STM32_DMA_H__      0001L
+
+#include    "main.h"
+#include    "sBtn_dma.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/* Max ports of a timer : the update request and the 4 CC requests */
+#define SIMPLEBTN_STM32_DMA_MAX_PORTS       5
+
+/**
+ * The timer and the DMA channels of a scanner, used as the `context` of
+ * `SimpleButton_Type_DmaScanConfig_t`.
+ *
+ * @note    Configure them in CubeMX : DMA peripheral-to-memory, circular,
+ *          half-word on both sides, memory increment, no peripheral increment.
+ *          The timer runs at the sampling rate (e.g. 1 kHz), and the CCRx
+ *          of the used CC requests are 0, so every request fires once per
+ *          period. The DMA IRQ of port 0 must be enabled.
+ */
+typedef struct SimpleButton_Type_Stm32DmaLink_t {
+
+    TIM_HandleTypeDef*              htim;
+
+    DMA_HandleTypeDef*              hdma[SIMPLEBTN_STM32_DMA_MAX_PORTS];    /* channel of port P */
+
+    uint32_t                        dmaSource[SIMPLEBTN_STM32_DMA_MAX_PORTS]; /* TIM_DMA_UPDATE, TIM_DMA_CC1, ... */
+
+    SimpleButton_Type_DmaScanner_t* scanner;
+
+} SimpleButton_Type_Stm32DmaLink_t;
+
+/* Start hook : `context` is the `SimpleButton_Type_Stm32DmaLink_t*`. */
+void
+SimpleButton_Stm32_DmaStart(
+    void* context,
+    const SimpleButton_Type_DmaPort_t* ports,
+    uint8_t portCount,
+    volatile uint16_t* buffer,
+    uint16_t depth
+);
+
+/* Stop hook */
+void
+SimpleButton_Stm32_DmaStop(void* context);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* SIMPLEBUTTON_STM32_DMA_H__ */